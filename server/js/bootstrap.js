@@ -5,6 +5,7 @@ const { ModuleWrap } = bindings.internalBinding("module_wrap");
 const path = require("path");
 const dns = require("dns");
 const url = require("url");
+const { Worker } = require("worker_threads");
 
 const alt = __altModule;
 
@@ -38,6 +39,7 @@ function setup() {
     dns.setDefaultResultOrder("ipv4first");
 
     setupImports();
+    setupWorkers();
 }
 
 // Sets up our custom way of importing alt:V resources
@@ -127,6 +129,149 @@ function setupImports() {
     esmLoader.addCustomLoaders(customLoaders);
 }
 
+// Sets up the worker pool API, to offload heavy computations from the main thread
+function setupWorkers() {
+    const defaultPoolSize = __workerPoolSize;
+    // Functions are sent as source code and cached per worker, so they can't use variables from their outer scope
+    const workerSource = `
+        const { parentPort } = require("worker_threads");
+        const functions = new Map();
+        parentPort.on("message", async ({ id, fn, data }) => {
+            try {
+                let func = functions.get(fn);
+                if (!func) {
+                    func = (0, eval)(\`(\${fn})\`);
+                    functions.set(fn, func);
+                }
+                parentPort.postMessage({ id, result: await func(data) });
+            } catch (e) {
+                parentPort.postMessage({ id, error: e instanceof Error ? { message: e.message, stack: e.stack } : { message: String(e) } });
+            }
+        });
+    `;
+
+    class WorkerPool {
+        #size;
+        #workers = [];
+        #idleWorkers = [];
+        #queue = [];
+        #jobs = new Map();
+        #nextJobId = 0;
+        #terminated = false;
+
+        constructor(size = defaultPoolSize) {
+            alt.Utils.assert(Number.isInteger(size) && size > 0, "Expected a positive integer as pool size");
+            this.#size = size;
+        }
+
+        get size() {
+            return this.#size;
+        }
+        get pending() {
+            return this.#queue.length + this.#jobs.size;
+        }
+
+        run(fn, data, transferList = []) {
+            alt.Utils.assert(typeof fn === "function", "Expected a function as first argument");
+            alt.Utils.assert(!this.#terminated, "Worker pool has been terminated");
+
+            return new Promise((resolve, reject) => {
+                this.#queue.push({ id: this.#nextJobId++, fn: fn.toString(), data, transferList, resolve, reject });
+                this.#dispatch();
+            });
+        }
+
+        terminate() {
+            if (this.#terminated) return;
+            this.#terminated = true;
+            for (const worker of this.#workers) worker.terminate();
+            const error = new Error("Worker pool has been terminated");
+            for (const job of this.#queue) job.reject(error);
+            for (const job of this.#jobs.values()) job.reject(error);
+            this.#workers.length = 0;
+            this.#idleWorkers.length = 0;
+            this.#queue.length = 0;
+            this.#jobs.clear();
+        }
+
+        #dispatch() {
+            while (this.#queue.length > 0) {
+                const worker = this.#idleWorkers.pop() ?? this.#createWorker();
+                if (!worker) return;
+
+                const job = this.#queue.shift();
+                worker.currentJob = job;
+                this.#jobs.set(job.id, job);
+                try {
+                    worker.postMessage({ id: job.id, fn: job.fn, data: job.data }, job.transferList);
+                } catch (e) {
+                    // E.g. the data can't be cloned, the worker never received the job so it is still idle
+                    this.#jobs.delete(job.id);
+                    worker.currentJob = null;
+                    this.#idleWorkers.push(worker);
+                    job.reject(e);
+                }
+            }
+        }
+
+        #createWorker() {
+            if (this.#workers.length >= this.#size) return null;
+
+            const worker = new Worker(workerSource, { eval: true });
+            worker.currentJob = null;
+            // Messages are received on the resource event loop, which is run in the resource tick,
+            // so the promises are always resolved on the main thread in the next tick after the job finished
+            worker.on("message", ({ id, result, error }) => {
+                const job = this.#jobs.get(id);
+                this.#jobs.delete(id);
+                worker.currentJob = null;
+                this.#idleWorkers.push(worker);
+                if (job) {
+                    if (error) job.reject(Object.assign(new Error(error.message), { stack: error.stack }));
+                    else job.resolve(result);
+                }
+                this.#dispatch();
+            });
+            worker.on("error", (err) => this.#removeWorker(worker, err));
+            worker.on("exit", (code) => this.#removeWorker(worker, new Error(`Worker exited with code ${code}`)));
+            // Don't keep the resource event loop alive because of idle workers
+            worker.unref();
+
+            this.#workers.push(worker);
+            return worker;
+        }
+
+        #removeWorker(worker, error) {
+            const idx = this.#workers.indexOf(worker);
+            if (idx === -1) return;
+            this.#workers.splice(idx, 1);
+            const idleIdx = this.#idleWorkers.indexOf(worker);
+            if (idleIdx !== -1) this.#idleWorkers.splice(idleIdx, 1);
+
+            if (worker.currentJob) {
+                this.#jobs.delete(worker.currentJob.id);
+                worker.currentJob.reject(error);
+                worker.currentJob = null;
+            }
+            if (!this.#terminated) this.#dispatch();
+        }
+    }
+
+    const defaultPool = new WorkerPool();
+    alt.Utils.Workers = {
+        Pool: WorkerPool,
+        get size() {
+            return defaultPool.size;
+        },
+        get pending() {
+            return defaultPool.pending;
+        },
+        run(fn, data, transferList) {
+            return defaultPool.run(fn, data, transferList);
+        },
+    };
+}
+
 // ***** Utils
 
 // Supresses the warning from NodeJS when importing "super-internal" modules,
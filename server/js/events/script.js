@@ -7,10 +7,19 @@ Event.register(alt.Enums.EventType.FIRE_EVENT, "FireStart");
 Event.register(alt.Enums.EventType.START_PROJECTILE_EVENT, "ProjectileStart");
 
 // Custom ColShape events
-Event.register(alt.Enums.CustomEventType.ENTITY_ENTER_COLSHAPE, "EntityColShapeEnter", true);
-Event.register(alt.Enums.CustomEventType.ENTITY_LEAVE_COLSHAPE, "EntityColShapeLeave", true);
-Event.register(alt.Enums.CustomEventType.ENTITY_ENTER_CHECKPOINT, "EntityCheckpointEnter", true);
-Event.register(alt.Enums.CustomEventType.ENTITY_LEAVE_CHECKPOINT, "EntityCheckpointLeave", true);
+// The colshape event is only subscribed while there are handlers for the custom events,
+// so colshape events are not sent to JS in resources that don't use them
+let colShapeEventHandlerCount = 0;
+function toggleColShapeEvent(state) {
+    colShapeEventHandlerCount += state ? 1 : -1;
+    if (state && colShapeEventHandlerCount === 1) alt.Events.onColShapeEvent(onColShapeEvent);
+    else if (!state && colShapeEventHandlerCount === 0) alt.Events.onColShapeEvent.remove(onColShapeEvent);
+}
+
+Event.register(alt.Enums.CustomEventType.ENTITY_ENTER_COLSHAPE, "EntityColShapeEnter", true, toggleColShapeEvent);
+Event.register(alt.Enums.CustomEventType.ENTITY_LEAVE_COLSHAPE, "EntityColShapeLeave", true, toggleColShapeEvent);
+Event.register(alt.Enums.CustomEventType.ENTITY_ENTER_CHECKPOINT, "EntityCheckpointEnter", true, toggleColShapeEvent);
+Event.register(alt.Enums.CustomEventType.ENTITY_LEAVE_CHECKPOINT, "EntityCheckpointLeave", true, toggleColShapeEvent);
 
 function getColShapeEventType(colShape, state) {
     const isCheckpoint = colShape instanceof alt.Checkpoint;
@@ -20,7 +29,7 @@ function getColShapeEventType(colShape, state) {
     if (isCheckpoint && !state) return alt.Enums.CustomEventType.ENTITY_LEAVE_CHECKPOINT;
 }
 
-alt.Events.onColShapeEvent(({ entity, colShape, state }) => {
+function onColShapeEvent({ entity, colShape, state }) {
     const eventType = getColShapeEventType(colShape, state);
     const data = {
         entity,
@@ -28,4 +37,4 @@ alt.Events.onColShapeEvent(({ entity, colShape, state }) => {
     };
 
     Event.invoke(eventType, data, true);
-});
+}
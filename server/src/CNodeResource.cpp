@@ -2,6 +2,7 @@
 #include "CNodeRuntime.h"
 #include "Bindings.h"
 #include "Event.h"
+#include "PlayerGroup.h"
 
 static void ResourceStarted(js::FunctionContext& ctx)
 {
@@ -52,6 +53,7 @@ bool CNodeResource::Start()
     js::TemporaryGlobalExtension altModuleExtension(_context, "__altModule", js::Module::Get("alt").GetNamespace(this));
     js::TemporaryGlobalExtension altSharedModuleExtension(_context, "__altSharedModule", js::Module::Get("alt-shared").GetNamespace(this));
     js::TemporaryGlobalExtension altServerModuleExtension(_context, "__resourceStarted", ResourceStarted);
+    js::TemporaryGlobalExtension workerPoolSizeExtension(_context, "__workerPoolSize", js::JSValue(CNodeRuntime::Instance().GetWorkerPoolSize()));
     node::LoadEnvironment(env, bootstrapper.GetSource());
 
     asyncResource.Reset(isolate, v8::Object::New(isolate));
@@ -59,7 +61,7 @@ bool CNodeResource::Start()
 
     while(!envStarted && !startError)
     {
-        CNodeRuntime::Instance().OnTick();
+        CNodeRuntime::Instance().DrainTasks();
         OnTick();
     }
 
@@ -90,14 +92,76 @@ bool CNodeResource::Stop()
     uv_loop_close(uvLoop);
     delete uvLoop;
 
+    std::unordered_set<PlayerGroup*> groups = std::move(playerGroups);
+    playerGroups.clear();
+    for(PlayerGroup* group : groups) delete group;
+    objectEventHandlers.Clear();
+    vehicleModelInfoCache.clear();
+    pedModelInfoCache.clear();
+
     IResource::Reset();
+    CNodeRuntime::Instance().RequestHeapCleanup();
 
     return true;
 }
 
 void CNodeResource::OnEvent(const alt::CEvent* ev)
 {
+    CNodeRuntime& runtime = CNodeRuntime::Instance();
+    double start = runtime.GetTime();
+    if(ev->GetType() == alt::CEvent::Type::CLIENT_SCRIPT_EVENT)
+    {
+        // Drop the event before its arguments are converted
+        auto clientEvent = static_cast<const alt::CClientScriptEvent*>(ev);
+        if(!clientEventRateLimiter.Consume(clientEvent->GetTarget(), clientEvent->GetName(), start)) return;
+    }
     IResource::OnEvent(ev);
+    if(!objectEventHandlers.IsEmpty())
+    {
+        v8::Locker locker(isolate);
+        v8::Isolate::Scope isolateScope(isolate);
+        v8::HandleScope handleScope(isolate);
+        v8::Context::Scope contextScope(GetContext());
+
+        objectEventHandlers.Dispatch(ev, this);
+    }
+    runtime.AddTickWorkTime(runtime.GetTime() - start);
+}
+
+void CNodeResource::OnRemoveBaseObject(alt::IBaseObject* object)
+{
+    IResource::OnRemoveBaseObject(object);
+    if(objectEventHandlers.RemoveObject(object)) UpdateCoreEvents();
+    if(object->GetType() != alt::IBaseObject::Type::PLAYER) return;
+
+    alt::IPlayer* player = static_cast<alt::IPlayer*>(object);
+    for(PlayerGroup* group : playerGroups) group->Remove(player);
+    clientEventRateLimiter.RemovePlayer(player);
+}
+
+v8::Local<v8::Object> CNodeResource::GetVehicleModelInfo(uint32_t model, const alt::VehicleModelInfo** info)
+{
+    auto it = vehicleModelInfoCache.find(model);
+    if(it == vehicleModelInfoCache.end()) return v8::Local<v8::Object>();
+    if(info) *info = it->second.info;
+    return it->second.object.Get(isolate);
+}
+
+void CNodeResource::SetVehicleModelInfo(uint32_t model, const alt::VehicleModelInfo* info, v8::Local<v8::Object> object)
+{
+    vehicleModelInfoCache.insert({ model, { js::Persistent<v8::Object>(isolate, object), info } });
+}
+
+v8::Local<v8::Object> CNodeResource::GetPedModelInfo(uint32_t model)
+{
+    auto it = pedModelInfoCache.find(model);
+    if(it == pedModelInfoCache.end()) return v8::Local<v8::Object>();
+    return it->second.Get(isolate);
+}
+
+void CNodeResource::SetPedModelInfo(uint32_t model, v8::Local<v8::Object> object)
+{
+    pedModelInfoCache.insert({ model, js::Persistent<v8::Object>(isolate, object) });
 }
 
 void CNodeResource::OnTick()
@@ -108,12 +172,19 @@ void CNodeResource::OnTick()
     v8::Context::Scope scope(GetContext());
     node::CallbackScope callbackScope(isolate, asyncResource.Get(isolate), asyncContext);
 
+    CNodeRuntime& runtime = CNodeRuntime::Instance();
+    double start = runtime.GetTime();
     uv_run(uvLoop, UV_RUN_NOWAIT);
     IResource::OnTick();
+    if(!inEventLoop) runtime.AddTickWorkTime(runtime.GetTime() - start);
 }
 
 void CNodeResource::RunEventLoop()
 {
-    CNodeRuntime::Instance().OnTick();
+    // Runs while JS of this resource is executing, so the time is already counted as work time of the outer tick or event
+    bool wasInEventLoop = inEventLoop;
+    inEventLoop = true;
+    CNodeRuntime::Instance().DrainTasks();
     IResource::RunEventLoop();
+    inEventLoop = wasInEventLoop;
 }
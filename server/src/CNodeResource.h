@@ -3,6 +3,12 @@
 #include "interfaces/IResource.h"
 #include "node.h"
 #include "uv.h"
+#include "ClientEventRateLimiter.h"
+#include "ObjectEventHandlers.h"
+
+#include <unordered_set>
+
+class PlayerGroup;
 
 class CNodeResource : public js::IResource
 {
@@ -13,6 +19,19 @@ class CNodeResource : public js::IResource
     node::async_context asyncContext;
     bool envStarted = false;
     bool startError = false;
+    bool inEventLoop = false;
+    std::unordered_set<PlayerGroup*> playerGroups;
+    ClientEventRateLimiter clientEventRateLimiter;
+    ObjectEventHandlers objectEventHandlers;
+
+    // Frozen model info objects, created on first use
+    struct VehicleModelInfoCacheEntry
+    {
+        js::Persistent<v8::Object> object;
+        const alt::VehicleModelInfo* info;
+    };
+    std::unordered_map<uint32_t, VehicleModelInfoCacheEntry> vehicleModelInfoCache;
+    std::unordered_map<uint32_t, js::Persistent<v8::Object>> pedModelInfoCache;
 
 public:
     CNodeResource(alt::IResource* resource, v8::Isolate* isolate) : IResource(resource, isolate) {}
@@ -24,6 +43,36 @@ public:
 
     void OnEvent(const alt::CEvent* ev) override;
     void OnTick() override;
+    void OnRemoveBaseObject(alt::IBaseObject* object) override;
+
+    bool IsEventUsed(alt::CEvent::Type type) const override
+    {
+        return IResource::IsEventUsed(type) || objectEventHandlers.HasEventHandlers(type);
+    }
+
+    void AddPlayerGroup(PlayerGroup* group)
+    {
+        playerGroups.insert(group);
+    }
+    void RemovePlayerGroup(PlayerGroup* group)
+    {
+        playerGroups.erase(group);
+    }
+
+    ClientEventRateLimiter& GetClientEventRateLimiter()
+    {
+        return clientEventRateLimiter;
+    }
+
+    ObjectEventHandlers& GetObjectEventHandlers()
+    {
+        return objectEventHandlers;
+    }
+
+    v8::Local<v8::Object> GetVehicleModelInfo(uint32_t model, const alt::VehicleModelInfo** info = nullptr);
+    void SetVehicleModelInfo(uint32_t model, const alt::VehicleModelInfo* info, v8::Local<v8::Object> object);
+    v8::Local<v8::Object> GetPedModelInfo(uint32_t model);
+    void SetPedModelInfo(uint32_t model, v8::Local<v8::Object> object);
 
     void RunEventLoop() override;
 };
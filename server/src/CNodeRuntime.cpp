@@ -1,6 +1,21 @@
 #include "CNodeRuntime.h"
 #include "Logger.h"
 
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
+// Falls back to the default if the configured number is not in the range of 1 to max,
+// so e.g. a negative queue size doesn't become a huge allocation or a max file size of 0 doesn't rotate the file on every line
+static size_t GetSizeConfig(Config::Value::ValuePtr config, const std::string& key, size_t defaultValue, size_t max)
+{
+    double value = config[key]->AsNumber((double)defaultValue);
+    if(value >= 1 && value <= (double)max) return (size_t)value;
+
+    js::Logger::Warn("Invalid value", value, "for", key, "specified, using the default value", defaultValue);
+    return defaultValue;
+}
+
 bool CNodeRuntime::Initialize()
 {
     std::vector<std::string> args = GetNodeArgs();
@@ -15,7 +30,47 @@ bool CNodeRuntime::Initialize()
         return false;
     }
 
-    platform = node::MultiIsolatePlatform::Create(4);
+    profile = GetPerformanceProfile();
+    Config::Value::ValuePtr moduleConfig = alt::ICore::Instance().GetServerConfig()["js-module-v2"];
+    if(moduleConfig->IsDict())
+    {
+        workerPoolSize = moduleConfig["worker-pool-size"]->AsNumber(workerPoolSize);
+        if(workerPoolSize < 1) workerPoolSize = 1;
+        js::IScriptObjectHandler::SetWeakScriptObjects(moduleConfig["weak-wrappers"]->AsBool(false));
+
+        Config::Value::ValuePtr logConfig = moduleConfig["logging"];
+        if(logConfig->IsDict())
+        {
+            js::LogWriter::Options logOptions;
+            logOptions.async = logConfig["async"]->AsBool(false);
+            logOptions.queueSize = GetSizeConfig(logConfig, "queue-size", logOptions.queueSize, 1 << 20);
+            logOptions.file = logConfig["file"]->AsString("");
+            logOptions.maxFileSize = GetSizeConfig(logConfig, "max-file-size", 10, 1024 * 1024) * 1024 * 1024;  // In MB
+            logOptions.maxFiles = GetSizeConfig(logConfig, "max-files", logOptions.maxFiles, 1000);
+            js::LogWriter::Instance().Start(logOptions);
+        }
+
+        Config::Value::ValuePtr errorConfig = moduleConfig["error-rate-limit"];
+        if(errorConfig->IsDict()) js::ErrorTracker::SetRateLimit((uint32_t)errorConfig["max-reports"]->AsNumber(5), errorConfig["window"]->AsNumber(10));
+    }
+
+    std::string v8Flags = GetV8Flags(profile);
+    v8::V8::SetFlagsFromString(v8Flags.c_str(), v8Flags.size());
+
+    js::Logger::Colored("~y~Performance profile:", profile.name);
+    js::Logger::Colored("  ~ly~thread pool size:", profile.threadPoolSize, "~ly~worker pool size:", workerPoolSize);
+    js::Logger::Colored("  ~ly~max semi space:", profile.maxSemiSpaceSize == 0 ? "default" : std::to_string(profile.maxSemiSpaceSize) + " MB",
+                        "~ly~max old space:", profile.maxOldSpaceSize == 0 ? "default" : std::to_string(profile.maxOldSpaceSize) + " MB");
+    js::Logger::Colored("  ~ly~concurrent marking:",
+                        profile.concurrentMarking ? "on" : "off",
+                        "~ly~concurrent sweeping:",
+                        profile.concurrentSweeping ? "on" : "off",
+                        "~ly~idle gc:",
+                        profile.idleGarbageCollection ? "on" : "off",
+                        "~ly~weak wrappers:",
+                        js::IScriptObjectHandler::AreScriptObjectsWeak() ? "on" : "off");
+
+    platform = node::MultiIsolatePlatform::Create(profile.threadPoolSize);
     if(!platform) return false;
     v8::V8::InitializePlatform(platform.get());
     v8::V8::Initialize();
@@ -31,16 +86,125 @@ bool CNodeRuntime::Initialize()
         IRuntime::Initialize();
     }
 
+    isolate->AddGCPrologueCallback(OnGCPrologue, this);
+    isolate->AddGCEpilogueCallback(OnGCEpilogue, this);
+
     return true;
 }
 
+void CNodeRuntime::OnDispose()
+{
+    // Write the remaining log entries while the core can still log them, instead of on static destruction
+    js::LogWriter::Instance().Stop();
+    IRuntime::OnDispose();
+}
+
+void CNodeRuntime::DrainTasks()
+{
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::SealHandleScope seal(isolate);
+
+    platform->DrainTasks(isolate);
+}
+
 void CNodeRuntime::OnTick()
 {
     v8::Locker locker(isolate);
     v8::Isolate::Scope isolateScope(isolate);
     v8::SealHandleScope seal(isolate);
 
+    double tickStart = GetTime();
     platform->DrainTasks(isolate);
+
+    // Only called by the core once per server tick, outside of any JS execution, so the idle work never runs inside JS frames
+    double idleDeadline = GetIdleDeadline(tickStart);
+    if(js::IScriptObjectHandler::AreScriptObjectsWeak())
+    {
+        // Sweep in idle time if possible, but don't wait forever on a busy server
+        ticksSinceSweep++;
+        if(idleDeadline != 0 || ticksSinceSweep >= maxTicksWithoutSweep)
+        {
+            SweepScriptObjects();
+            ticksSinceSweep = 0;
+        }
+    }
+    if(profile.idleGarbageCollection && idleDeadline != 0) RunIdleGarbageCollection(idleDeadline);
+}
+
+double CNodeRuntime::GetIdleDeadline(double tickStart)
+{
+    // The slack is estimated from the average tick interval and the time the resources spent in the last tick
+    if(lastTickTime != 0)
+    {
+        double interval = tickStart - lastTickTime;
+        averageTickInterval = averageTickInterval == 0 ? interval : averageTickInterval * 0.9 + interval * 0.1;
+    }
+    lastTickTime = tickStart;
+    double workTime = tickWorkTime;
+    tickWorkTime = 0;
+
+    double now = GetTime();
+    double slack = averageTickInterval - workTime - (now - tickStart) - idleSafetyMargin;
+    if(slack < minIdleTime) return 0;
+    return now + std::min(slack, maxIdleTime);
+}
+
+void CNodeRuntime::RunIdleGarbageCollection(double deadline)
+{
+    double start = GetTime();
+    if(start >= deadline) return;
+
+    inIdlePeriod = true;
+    if(heapCleanupRequested)
+    {
+        heapCleanupRequested = false;
+        isolate->MemoryPressureNotification(v8::MemoryPressureLevel::kModerate);
+    }
+    else
+    {
+        v8::HeapStatistics heapStats;
+        isolate->GetHeapStatistics(&heapStats);
+        if(heapStats.used_heap_size() > heapStats.heap_size_limit() * 0.8) isolate->MemoryPressureNotification(v8::MemoryPressureLevel::kModerate);
+    }
+    if(GetTime() < deadline) isolate->IdleNotificationDeadline(deadline);
+    inIdlePeriod = false;
+
+    idleStats.idlePeriods++;
+    idleStats.idleTime += GetTime() - start;
+}
+
+void CNodeRuntime::SweepScriptObjects()
+{
+    v8::HandleScope handleScope(isolate);
+    for(alt::IResource* altResource : alt::ICore::Instance().GetAllResources())
+    {
+        if(altResource->GetType() != "jsv2" || !altResource->IsStarted()) continue;
+        CNodeResource* resource = static_cast<CNodeResource*>(altResource->GetImpl());
+
+        v8::Local<v8::Context> context = resource->GetContext();
+        v8::Context::Scope contextScope(context);
+        resource->SweepScriptObjects(context);
+    }
+}
+
+void CNodeRuntime::OnGCPrologue(v8::Isolate*, v8::GCType, v8::GCCallbackFlags, void* data)
+{
+    CNodeRuntime* runtime = static_cast<CNodeRuntime*>(data);
+    runtime->gcStartTime = runtime->GetTime();
+}
+
+void CNodeRuntime::OnGCEpilogue(v8::Isolate*, v8::GCType, v8::GCCallbackFlags, void* data)
+{
+    CNodeRuntime* runtime = static_cast<CNodeRuntime*>(data);
+    double time = runtime->GetTime() - runtime->gcStartTime;
+    runtime->idleStats.gcCount++;
+    runtime->idleStats.gcTime += time;
+    if(runtime->inIdlePeriod)
+    {
+        runtime->idleStats.idleGcCount++;
+        runtime->idleStats.idleGcTime += time;
+    }
 }
 
 std::vector<std::string> CNodeRuntime::GetNodeArgs()
@@ -84,3 +248,52 @@ std::vector<std::string> CNodeRuntime::GetNodeArgs()
 
     return args;
 }
+
+CNodeRuntime::PerformanceProfile CNodeRuntime::GetPerformanceProfile()
+{
+    static std::unordered_map<std::string, PerformanceProfile> profiles = {
+        { "default", { "default" } },
+        // Keep the main thread pauses as short as possible, at the cost of more background work
+        { "low-latency", { "low-latency", 4, 16, 0, true, true, true } },
+        // Bigger young generation and more background threads, less frequent but longer scavenges
+        { "throughput", { "throughput", 8, 64, 0, true, true, false } },
+        // Small heap limits and no extra marking / sweeping threads
+        { "low-memory", { "low-memory", 2, 1, 512, false, false, true } },
+    };
+
+    PerformanceProfile profile = profiles["default"];
+
+    Config::Value::ValuePtr moduleConfig = alt::ICore::Instance().GetServerConfig()["js-module-v2"];
+    if(!moduleConfig->IsDict()) return profile;
+
+    std::string profileName = moduleConfig["profile"]->AsString("default");
+    auto it = profiles.find(profileName);
+    if(it != profiles.end()) profile = it->second;
+    else
+        js::Logger::Warn("Unknown performance profile", profileName, "specified, using default profile");
+
+    // Allow overriding single settings of the profile
+    Config::Value::ValuePtr gcConfig = moduleConfig["gc"];
+    profile.threadPoolSize = moduleConfig["thread-pool-size"]->AsNumber(profile.threadPoolSize);
+    if(gcConfig->IsDict())
+    {
+        profile.maxSemiSpaceSize = gcConfig["max-semi-space-size"]->AsNumber(profile.maxSemiSpaceSize);
+        profile.maxOldSpaceSize = gcConfig["max-old-space-size"]->AsNumber(profile.maxOldSpaceSize);
+        profile.concurrentMarking = gcConfig["concurrent-marking"]->AsBool(profile.concurrentMarking);
+        profile.concurrentSweeping = gcConfig["concurrent-sweeping"]->AsBool(profile.concurrentSweeping);
+        profile.idleGarbageCollection = gcConfig["idle"]->AsBool(profile.idleGarbageCollection);
+    }
+    if(profile.threadPoolSize < 1) profile.threadPoolSize = 1;
+
+    return profile;
+}
+
+std::string CNodeRuntime::GetV8Flags(const PerformanceProfile& profile)
+{
+    std::stringstream flags;
+    if(profile.maxSemiSpaceSize > 0) flags << "--max-semi-space-size=" << profile.maxSemiSpaceSize << " ";
+    if(profile.maxOldSpaceSize > 0) flags << "--max-old-space-size=" << profile.maxOldSpaceSize << " ";
+    flags << (profile.concurrentMarking ? "--concurrent-marking" : "--no-concurrent-marking") << " ";
+    flags << (profile.concurrentSweeping ? "--concurrent-sweeping" : "--no-concurrent-sweeping");
+    return flags.str();
+}
@@ -9,17 +9,104 @@
 
 class CNodeRuntime : public js::IRuntime<CNodeRuntime, CNodeResource>
 {
+public:
+    struct PerformanceProfile
+    {
+        std::string name;
+        int threadPoolSize = 4;
+        int maxSemiSpaceSize = 0;  // In MB, 0 uses the V8 default
+        int maxOldSpaceSize = 0;   // In MB, 0 uses the V8 default
+        bool concurrentMarking = true;
+        bool concurrentSweeping = true;
+        bool idleGarbageCollection = false;
+    };
+
+    struct IdleStats
+    {
+        uint64_t idlePeriods = 0;
+        double idleTime = 0;  // In seconds
+        uint64_t gcCount = 0;
+        double gcTime = 0;  // In seconds
+        uint64_t idleGcCount = 0;
+        double idleGcTime = 0;  // In seconds
+    };
+
+private:
+    // Idle work is only done when the estimated slack of the tick is above the minimum,
+    // and never takes more than the maximum, to not delay the next tick
+    static constexpr double minIdleTime = 0.001;
+    static constexpr double maxIdleTime = 0.01;
+    static constexpr double idleSafetyMargin = 0.002;
+    static constexpr int maxTicksWithoutSweep = 10;
+
     static std::vector<std::string> GetNodeArgs();
+    static PerformanceProfile GetPerformanceProfile();
+    static std::string GetV8Flags(const PerformanceProfile& profile);
 
     std::unique_ptr<node::MultiIsolatePlatform> platform;
+    PerformanceProfile profile;
+    int workerPoolSize = 4;
+
+    double lastTickTime = 0;
+    double averageTickInterval = 0;
+    double tickWorkTime = 0;
+    bool heapCleanupRequested = false;
+    int ticksSinceSweep = 0;
+    bool inIdlePeriod = false;
+    double gcStartTime = 0;
+    IdleStats idleStats;
+
+    double GetIdleDeadline(double tickStart);
+    void RunIdleGarbageCollection(double deadline);
+    void SweepScriptObjects();
+
+    static void OnGCPrologue(v8::Isolate* isolate, v8::GCType type, v8::GCCallbackFlags flags, void* data);
+    static void OnGCEpilogue(v8::Isolate* isolate, v8::GCType type, v8::GCCallbackFlags flags, void* data);
 
 public:
     bool Initialize() override;
 
+    // Runs the platform tasks and the idle work of the server tick
     void OnTick() override;
+    void OnDispose() override;
+
+    // Only runs the platform tasks, used to run the event loop outside of the server tick, e.g. while a promise is awaited
+    void DrainTasks();
 
     node::MultiIsolatePlatform* GetPlatform() const
     {
         return platform.get();
     }
+
+    const PerformanceProfile& GetProfile() const
+    {
+        return profile;
+    }
+
+    int GetWorkerPoolSize() const
+    {
+        return workerPoolSize;
+    }
+
+    double GetTime() const
+    {
+        return platform->MonotonicallyIncreasingTime();
+    }
+
+    // Used to estimate how much of the tick is left for idle work
+    void AddTickWorkTime(double time)
+    {
+        tickWorkTime += time;
+    }
+
+    // Asks V8 to reduce the heap size in the next idle period, e.g. after a resource has been stopped
+    void RequestHeapCleanup()
+    {
+        heapCleanupRequested = true;
+    }
+
+    const IdleStats& GetIdleStats() const
+    {
+        return idleStats;
+    }
 };
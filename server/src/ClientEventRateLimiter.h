@@ -0,0 +1,103 @@
+#pragma once
+
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+
+#include "cpp-sdk/SDK.h"
+
+// Token bucket rate limiter for client script events, per player and event name
+// Events without their own limit share the bucket of the '*' limit, if one is set
+class ClientEventRateLimiter
+{
+public:
+    static constexpr const char* wildcard = "*";
+
+    struct Limit
+    {
+        double perSecond = 0;
+        double burst = 0;
+        uint64_t dropped = 0;
+    };
+
+private:
+    struct Bucket
+    {
+        double tokens = 0;
+        double lastUpdate = 0;
+    };
+
+    struct PlayerState
+    {
+        std::unordered_map<std::string, Bucket> buckets;
+        uint64_t dropped = 0;
+    };
+
+    std::unordered_map<std::string, Limit> limits;
+    std::unordered_map<alt::IPlayer*, PlayerState> players;
+    uint64_t dropped = 0;
+
+public:
+    void SetLimit(const std::string& eventName, double perSecond, double burst)
+    {
+        Limit& limit = limits[eventName];
+        limit.perSecond = perSecond;
+        limit.burst = burst;
+    }
+    void RemoveLimit(const std::string& eventName)
+    {
+        limits.erase(eventName);
+        for(auto& [player, state] : players) state.buckets.erase(eventName);
+    }
+
+    // Returns false if the event should be dropped
+    bool Consume(alt::IPlayer* player, const std::string& eventName, double time)
+    {
+        if(limits.empty()) return true;
+
+        auto limitIt = limits.find(eventName);
+        if(limitIt == limits.end())
+        {
+            limitIt = limits.find(wildcard);
+            if(limitIt == limits.end()) return true;
+        }
+        Limit& limit = limitIt->second;
+
+        PlayerState& state = players[player];
+        auto bucketIt = state.buckets.find(limitIt->first);
+        if(bucketIt == state.buckets.end()) bucketIt = state.buckets.insert({ limitIt->first, Bucket{ limit.burst, time } }).first;
+        Bucket& bucket = bucketIt->second;
+
+        bucket.tokens = std::min(limit.burst, bucket.tokens + (time - bucket.lastUpdate) * limit.perSecond);
+        bucket.lastUpdate = time;
+        if(bucket.tokens >= 1)
+        {
+            bucket.tokens -= 1;
+            return true;
+        }
+
+        limit.dropped++;
+        state.dropped++;
+        dropped++;
+        return false;
+    }
+
+    void RemovePlayer(alt::IPlayer* player)
+    {
+        players.erase(player);
+    }
+
+    const std::unordered_map<std::string, Limit>& GetLimits() const
+    {
+        return limits;
+    }
+    uint64_t GetDropCount() const
+    {
+        return dropped;
+    }
+    uint64_t GetDropCount(alt::IPlayer* player) const
+    {
+        auto it = players.find(player);
+        return it == players.end() ? 0 : it->second.dropped;
+    }
+};
@@ -47,6 +47,8 @@ static void ModuleCommand(const std::vector<std::string>& args)
         js::Logger::Colored("~y~Usage: ~w~js-module-v2 [options]");
         js::Logger::Colored("~y~Options:");
         js::Logger::Colored("  ~ly~--version ~w~- Version info");
+        js::Logger::Colored("  ~ly~--gc-stats ~w~- Garbage collection stats");
+        js::Logger::Colored("  ~ly~--log-flush ~w~- Write all queued log entries and show log stats");
     }
     else if(args[0] == "--version")
     {
@@ -55,6 +57,32 @@ static void ModuleCommand(const std::vector<std::string>& args)
         js::Logger::Colored("~ly~cpp-sdk:", ALT_SDK_VERSION);
         js::Logger::Colored("~ly~nodejs:", std::to_string(NODE_MAJOR_VERSION) + "." + std::to_string(NODE_MINOR_VERSION) + "." + std::to_string(NODE_PATCH_VERSION));
     }
+    else if(args[0] == "--gc-stats")
+    {
+        const CNodeRuntime::IdleStats& stats = CNodeRuntime::Instance().GetIdleStats();
+        double idleGcPercentage = stats.gcTime == 0 ? 0 : stats.idleGcTime / stats.gcTime * 100;
+        js::Logger::Colored("~g~GC stats:");
+        js::Logger::Colored("~ly~idle gc:", CNodeRuntime::Instance().GetProfile().idleGarbageCollection ? "on" : "off");
+        js::Logger::Colored("~ly~idle periods:", stats.idlePeriods, "~ly~idle time:", std::to_string(stats.idleTime * 1000) + " ms");
+        js::Logger::Colored("~ly~total gcs:", stats.gcCount, "~ly~total gc time:", std::to_string(stats.gcTime * 1000) + " ms");
+        js::Logger::Colored("~ly~idle gcs:", stats.idleGcCount, "~ly~idle gc time:", std::to_string(stats.idleGcTime * 1000) + " ms", "(" + std::to_string(idleGcPercentage) + "%)");
+    }
+    else if(args[0] == "--log-flush")
+    {
+        js::LogWriter& writer = js::LogWriter::Instance();
+        writer.Flush();
+        js::LogWriter::Stats stats = writer.GetStats();
+        using Type = js::LogWriter::Type;
+        js::Logger::Colored("~g~Log stats:");
+        js::Logger::Colored("~ly~async:", writer.IsAsync() ? "on" : "off", "~ly~file:", writer.HasFile() ? "on" : "off");
+        js::Logger::Colored("~ly~queued:", stats.queued, "~ly~written:", stats.written);
+        js::Logger::Colored("~ly~dropped info:",
+                            stats.dropped[(size_t)Type::INFO] + stats.dropped[(size_t)Type::COLORED],
+                            "~ly~dropped warnings:",
+                            stats.dropped[(size_t)Type::WARN],
+                            "~ly~dropped errors:",
+                            stats.dropped[(size_t)Type::ERR]);
+    }
 }
 
 EXPORT bool altMain(alt::ICore* core)
@@ -67,6 +95,9 @@ EXPORT bool altMain(alt::ICore* core)
 
     core->SubscribeCommand("js-module-v2", ModuleCommand);
     core->SubscribeCommand("debughandles", js::DebugHandlesCommand);
+#ifdef DEBUG_ALLOCATIONS
+    core->SubscribeCommand("bindingstats", js::BindingStatsCommand);
+#endif
 
     js::Logger::Colored("Loaded ~g~JS module v2");
 
@@ -0,0 +1,144 @@
+#include <array>
+
+#include "ObjectEventHandlers.h"
+#include "CNodeResource.h"
+
+using EventObjects = std::array<alt::IBaseObject*, 2>;
+
+// Gets the base objects an event is about, handlers subscribed to any of them are called
+static EventObjects GetEventObjects(const alt::CEvent* ev)
+{
+    switch(ev->GetType())
+    {
+        case alt::CEvent::Type::PLAYER_CONNECT: return { static_cast<const alt::CPlayerConnectEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::PLAYER_DISCONNECT: return { static_cast<const alt::CPlayerDisconnectEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::PLAYER_DAMAGE: return { static_cast<const alt::CPlayerDamageEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::PLAYER_DEATH: return { static_cast<const alt::CPlayerDeathEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::PLAYER_WEAPON_CHANGE: return { static_cast<const alt::CPlayerWeaponChangeEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::PLAYER_CHANGE_INTERIOR_EVENT: return { static_cast<const alt::CPlayerChangeInteriorEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::PLAYER_DIMENSION_CHANGE: return { static_cast<const alt::CPlayerDimensionChangeEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::PLAYER_CHANGE_ANIMATION_EVENT: return { static_cast<const alt::CPlayerChangeAnimationEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::PLAYER_ENTER_VEHICLE:
+        {
+            auto e = static_cast<const alt::CPlayerEnterVehicleEvent*>(ev);
+            return { e->GetPlayer(), e->GetTarget() };
+        }
+        case alt::CEvent::Type::PLAYER_ENTERING_VEHICLE:
+        {
+            auto e = static_cast<const alt::CPlayerEnteringVehicleEvent*>(ev);
+            return { e->GetPlayer(), e->GetTarget() };
+        }
+        case alt::CEvent::Type::PLAYER_LEAVE_VEHICLE:
+        {
+            auto e = static_cast<const alt::CPlayerLeaveVehicleEvent*>(ev);
+            return { e->GetPlayer(), e->GetTarget() };
+        }
+        case alt::CEvent::Type::PLAYER_CHANGE_VEHICLE_SEAT:
+        {
+            auto e = static_cast<const alt::CPlayerChangeVehicleSeatEvent*>(ev);
+            return { e->GetPlayer(), e->GetTarget() };
+        }
+        case alt::CEvent::Type::PLAYER_REQUEST_CONTROL:
+        {
+            auto e = static_cast<const alt::CPlayerRequestControlEvent*>(ev);
+            return { e->GetPlayer(), e->GetTarget() };
+        }
+        case alt::CEvent::Type::VEHICLE_DESTROY: return { static_cast<const alt::CVehicleDestroyEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::VEHICLE_DAMAGE: return { static_cast<const alt::CVehicleDamageEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::VEHICLE_SIREN: return { static_cast<const alt::CVehicleSirenEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::VEHICLE_ATTACH:
+        {
+            auto e = static_cast<const alt::CVehicleAttachEvent*>(ev);
+            return { e->GetTarget(), e->GetAttached() };
+        }
+        case alt::CEvent::Type::VEHICLE_DETACH:
+        {
+            auto e = static_cast<const alt::CVehicleDetachEvent*>(ev);
+            return { e->GetTarget(), e->GetDetached() };
+        }
+        case alt::CEvent::Type::NETOWNER_CHANGE: return { static_cast<const alt::CNetOwnerChangeEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::SYNCED_META_CHANGE: return { static_cast<const alt::CSyncedMetaDataChangeEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::STREAM_SYNCED_META_CHANGE: return { static_cast<const alt::CStreamSyncedMetaDataChangeEvent*>(ev)->GetTarget(), nullptr };
+        case alt::CEvent::Type::COLSHAPE_EVENT:
+        {
+            auto e = static_cast<const alt::CColShapeEvent*>(ev);
+            return { e->GetTarget(), e->GetEntity() };
+        }
+        case alt::CEvent::Type::WEAPON_DAMAGE_EVENT:
+        {
+            auto e = static_cast<const alt::CWeaponDamageEvent*>(ev);
+            return { e->GetSource(), e->GetTarget() };
+        }
+        default: break;
+    }
+    return { nullptr, nullptr };
+}
+
+// Has to match the events handled in GetEventObjects
+bool ObjectEventHandlers::IsObjectEvent(alt::CEvent::Type type)
+{
+    switch(type)
+    {
+        case alt::CEvent::Type::PLAYER_CONNECT:
+        case alt::CEvent::Type::PLAYER_DISCONNECT:
+        case alt::CEvent::Type::PLAYER_DAMAGE:
+        case alt::CEvent::Type::PLAYER_DEATH:
+        case alt::CEvent::Type::PLAYER_WEAPON_CHANGE:
+        case alt::CEvent::Type::PLAYER_CHANGE_INTERIOR_EVENT:
+        case alt::CEvent::Type::PLAYER_DIMENSION_CHANGE:
+        case alt::CEvent::Type::PLAYER_CHANGE_ANIMATION_EVENT:
+        case alt::CEvent::Type::PLAYER_ENTER_VEHICLE:
+        case alt::CEvent::Type::PLAYER_ENTERING_VEHICLE:
+        case alt::CEvent::Type::PLAYER_LEAVE_VEHICLE:
+        case alt::CEvent::Type::PLAYER_CHANGE_VEHICLE_SEAT:
+        case alt::CEvent::Type::PLAYER_REQUEST_CONTROL:
+        case alt::CEvent::Type::VEHICLE_DESTROY:
+        case alt::CEvent::Type::VEHICLE_DAMAGE:
+        case alt::CEvent::Type::VEHICLE_SIREN:
+        case alt::CEvent::Type::VEHICLE_ATTACH:
+        case alt::CEvent::Type::VEHICLE_DETACH:
+        case alt::CEvent::Type::NETOWNER_CHANGE:
+        case alt::CEvent::Type::SYNCED_META_CHANGE:
+        case alt::CEvent::Type::STREAM_SYNCED_META_CHANGE:
+        case alt::CEvent::Type::COLSHAPE_EVENT:
+        case alt::CEvent::Type::WEAPON_DAMAGE_EVENT: return true;
+        default: return false;
+    }
+}
+
+void ObjectEventHandlers::Dispatch(const alt::CEvent* ev, CNodeResource* resource)
+{
+    if(objects.empty()) return;
+
+    EventObjects eventObjects = GetEventObjects(ev);
+    v8::Isolate* isolate = resource->GetIsolate();
+    std::vector<v8::Local<v8::Function>> handlers;
+    auto addHandlers = [&](alt::IBaseObject* object, Key key)
+    {
+        auto objectIt = objects.find(object);
+        if(objectIt == objects.end()) return;
+        auto handlersIt = objectIt->second.find(key);
+        if(handlersIt == objectIt->second.end()) return;
+        for(auto& handler : handlersIt->second) handlers.push_back(handler.Get(isolate));
+    };
+
+    for(alt::IBaseObject* object : eventObjects)
+    {
+        if(!object) continue;
+        addHandlers(object, GetKey(ev->GetType()));
+    }
+    if(ev->GetType() == alt::CEvent::Type::COLSHAPE_EVENT)
+    {
+        bool state = static_cast<const alt::CColShapeEvent*>(ev)->GetState();
+        addHandlers(eventObjects[0], GetKey(state ? js::EventType::ENTITY_ENTER_COLSHAPE : js::EventType::ENTITY_LEAVE_COLSHAPE));
+    }
+    if(handlers.empty()) return;
+
+    // The handlers were copied, so they can subscribe or unsubscribe while being called
+    js::Event::WithEventArgs(ev,
+                             resource,
+                             [&](js::Event::EventArgs& args)
+                             {
+                                 for(v8::Local<v8::Function> handler : handlers) js::Function(handler).Call(args.Get());
+                             });
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
+#include "v8.h"
+#include "cpp-sdk/SDK.h"
+#include "helpers/JS.h"
+#include "Event.h"
+
+class CNodeResource;
+
+// Event handlers subscribed to a single base object, e.g. via `entity.on` or `colShape.onEnter`
+// The table is checked natively, so events of objects without handlers are never converted or sent to JS
+class ObjectEventHandlers
+{
+public:
+    // Built-in event type, or custom event type with the custom bit set
+    using Key = uint32_t;
+
+    static Key GetKey(alt::CEvent::Type type)
+    {
+        return (Key)type;
+    }
+    static Key GetKey(js::EventType type)
+    {
+        return (Key)type | customBit;
+    }
+    // The built-in event that has to be enabled for the handlers, custom events are only the colshape enter and leave events
+    static alt::CEvent::Type GetEventType(Key key)
+    {
+        return (key & customBit) ? alt::CEvent::Type::COLSHAPE_EVENT : (alt::CEvent::Type)key;
+    }
+
+private:
+    static constexpr Key customBit = 1u << 31;
+
+    using HandlerMap = std::unordered_map<Key, std::vector<js::Persistent<v8::Function>>>;
+    std::unordered_map<alt::IBaseObject*, HandlerMap> objects;
+    std::unordered_map<alt::CEvent::Type, uint32_t> eventHandlerCounts;
+
+public:
+    void Add(alt::IBaseObject* object, Key key, v8::Local<v8::Function> handler)
+    {
+        objects[object][key].push_back(js::Persistent<v8::Function>(v8::Isolate::GetCurrent(), handler));
+        eventHandlerCounts[GetEventType(key)]++;
+    }
+    bool Remove(alt::IBaseObject* object, Key key, v8::Local<v8::Function> handler)
+    {
+        auto objectIt = objects.find(object);
+        if(objectIt == objects.end()) return false;
+        auto handlersIt = objectIt->second.find(key);
+        if(handlersIt == objectIt->second.end()) return false;
+
+        std::vector<js::Persistent<v8::Function>>& handlers = handlersIt->second;
+        auto it = std::find(handlers.begin(), handlers.end(), handler);
+        if(it == handlers.end()) return false;
+        handlers.erase(it);
+        eventHandlerCounts[GetEventType(key)]--;
+
+        if(handlers.empty()) objectIt->second.erase(handlersIt);
+        if(objectIt->second.empty()) objects.erase(objectIt);
+        return true;
+    }
+    // Returns whether the object had any handlers
+    bool RemoveObject(alt::IBaseObject* object)
+    {
+        auto objectIt = objects.find(object);
+        if(objectIt == objects.end()) return false;
+        for(auto& [key, handlers] : objectIt->second) eventHandlerCounts[GetEventType(key)] -= (uint32_t)handlers.size();
+        objects.erase(objectIt);
+        return true;
+    }
+    void Clear()
+    {
+        objects.clear();
+        eventHandlerCounts.clear();
+    }
+
+    bool IsEmpty() const
+    {
+        return objects.empty();
+    }
+    bool HasEventHandlers(alt::CEvent::Type type) const
+    {
+        auto it = eventHandlerCounts.find(type);
+        return it != eventHandlerCounts.end() && it->second > 0;
+    }
+    size_t GetHandlerCount(alt::IBaseObject* object, Key key) const
+    {
+        auto objectIt = objects.find(object);
+        if(objectIt == objects.end()) return 0;
+        auto handlersIt = objectIt->second.find(key);
+        return handlersIt == objectIt->second.end() ? 0 : handlersIt->second.size();
+    }
+
+    // Whether the event is about base objects, handlers can only be subscribed to objects for these events
+    static bool IsObjectEvent(alt::CEvent::Type type);
+
+    // Calls the handlers of all objects involved in the event, has to be called while a context is entered
+    void Dispatch(const alt::CEvent* ev, CNodeResource* resource);
+};
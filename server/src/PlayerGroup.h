@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+
+#include "v8.h"
+#include "cpp-sdk/SDK.h"
+#include "helpers/JS.h"
+
+class CNodeResource;
+
+// Keeps a resolved list of players, so emitting to the same players repeatedly doesn't have to convert them every time
+// Players are removed from all groups of a resource when they are destroyed
+class PlayerGroup
+{
+    CNodeResource* resource;
+    js::Persistent<v8::Object> handle;
+    std::vector<alt::IPlayer*> players;
+    std::unordered_map<alt::IPlayer*, size_t> indices;
+
+    static void WeakCallback(const v8::WeakCallbackInfo<PlayerGroup>& info);
+
+public:
+    PlayerGroup(CNodeResource* _resource, v8::Local<v8::Object> object);
+    ~PlayerGroup();
+
+    bool Add(alt::IPlayer* player)
+    {
+        if(indices.contains(player)) return false;
+        indices.insert({ player, players.size() });
+        players.push_back(player);
+        return true;
+    }
+    bool Remove(alt::IPlayer* player)
+    {
+        auto it = indices.find(player);
+        if(it == indices.end()) return false;
+
+        // Swap with the last player to keep removing O(1)
+        size_t index = it->second;
+        alt::IPlayer* last = players.back();
+        players[index] = last;
+        indices[last] = index;
+        players.pop_back();
+        indices.erase(player);
+        return true;
+    }
+    bool Has(alt::IPlayer* player) const
+    {
+        return indices.contains(player);
+    }
+    void Clear()
+    {
+        players.clear();
+        indices.clear();
+    }
+
+    const std::vector<alt::IPlayer*>& GetPlayers() const
+    {
+        return players;
+    }
+
+    // Returns nullptr if the value is not a player group
+    static PlayerGroup* Get(v8::Local<v8::Value> value);
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+
+#include "v8.h"
+#include "cpp-sdk/SDK.h"
+#include "helpers/JS.h"
+#include "helpers/CallContext.h"
+
+// Event name and arguments converted once, so the same message can be emitted many times without converting the arguments again
+class PreparedEvent
+{
+    js::Persistent<v8::Object> handle;
+    std::string eventName;
+    alt::MValueArgs args;
+    size_t size;
+
+    static void WeakCallback(const v8::WeakCallbackInfo<PreparedEvent>& info);
+
+public:
+    PreparedEvent(v8::Local<v8::Object> object, const std::string& _eventName, const alt::MValueArgs& _args);
+    ~PreparedEvent()
+    {
+        handle.Reset();
+    }
+
+    const std::string& GetEventName() const
+    {
+        return eventName;
+    }
+    const alt::MValueArgs& GetArgs() const
+    {
+        return args;
+    }
+    // Approximate size of the serialized arguments in bytes
+    size_t GetSize() const
+    {
+        return size;
+    }
+
+    static v8::Local<v8::Object> Create(v8::Local<v8::Context> context, const std::string& eventName, const alt::MValueArgs& args);
+    // Returns nullptr if the value is not a prepared event
+    static PreparedEvent* Get(v8::Local<v8::Value> value);
+};
+
+// Either points to a prepared event, or holds the converted event name and arguments
+struct EventMessage
+{
+    PreparedEvent* prepared = nullptr;
+    std::string eventName;
+    alt::MValueArgs args;
+
+    const std::string& GetEventName() const
+    {
+        return prepared ? prepared->GetEventName() : eventName;
+    }
+    const alt::MValueArgs& GetArgs() const
+    {
+        return prepared ? prepared->GetArgs() : args;
+    }
+};
+
+// Reads a prepared event or an event name followed by the arguments, starting at the specified index
+bool GetEventMessage(js::FunctionContext& ctx, int index, EventMessage& message);
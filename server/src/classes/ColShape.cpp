@@ -1,5 +1,37 @@
 #include "Class.h"
 #include "cpp-sdk/ICore.h"
+#include "CNodeResource.h"
+
+template<js::EventType Type>
+static void On(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckThis()) return;
+    if(!ctx.CheckArgCount(1)) return;
+    alt::IColShape* colShape = ctx.GetThisObject<alt::IColShape>();
+
+    v8::Local<v8::Value> handler;
+    if(!ctx.GetArg(0, handler, js::Type::FUNCTION)) return;
+
+    CNodeResource* resource = static_cast<CNodeResource*>(ctx.GetResource());
+    resource->GetObjectEventHandlers().Add(colShape, ObjectEventHandlers::GetKey(Type), handler.As<v8::Function>());
+    resource->UpdateCoreEvent(alt::CEvent::Type::COLSHAPE_EVENT);
+}
+
+template<js::EventType Type>
+static void Off(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckThis()) return;
+    if(!ctx.CheckArgCount(1)) return;
+    alt::IColShape* colShape = ctx.GetThisObject<alt::IColShape>();
+
+    v8::Local<v8::Value> handler;
+    if(!ctx.GetArg(0, handler, js::Type::FUNCTION)) return;
+
+    CNodeResource* resource = static_cast<CNodeResource*>(ctx.GetResource());
+    bool removed = resource->GetObjectEventHandlers().Remove(colShape, ObjectEventHandlers::GetKey(Type), handler.As<v8::Function>());
+    if(removed) resource->UpdateCoreEvent(alt::CEvent::Type::COLSHAPE_EVENT);
+    ctx.Return(removed);
+}
 
 // clang-format off
 extern js::Class worldObjectClass;
@@ -13,6 +45,11 @@ extern js::Class colShapeClass("ColShape", &worldObjectClass, nullptr, [](js::Cl
     tpl.Method<&alt::IColShape::IsEntityIn>("isEntityIn");
     tpl.Method<&alt::IColShape::IsEntityIdIn>("isEntityIdIn");
     tpl.Method<&alt::IColShape::IsPointIn>("isPointIn");
+
+    tpl.Method("onEnter", On<js::EventType::ENTITY_ENTER_COLSHAPE>);
+    tpl.Method("onLeave", On<js::EventType::ENTITY_LEAVE_COLSHAPE>);
+    tpl.Method("offEnter", Off<js::EventType::ENTITY_ENTER_COLSHAPE>);
+    tpl.Method("offLeave", Off<js::EventType::ENTITY_LEAVE_COLSHAPE>);
 });
 
 extern js::Class checkpointClass("Checkpoint", &colShapeClass, nullptr, [](js::ClassTemplate& tpl)
@@ -1,5 +1,7 @@
 #include "Class.h"
 #include "cpp-sdk/ICore.h"
+#include "CNodeResource.h"
+#include "helpers/MetaBatch.h"
 
 static void GetByID(js::FunctionContext& ctx)
 {
@@ -87,6 +89,7 @@ static void SyncedMetaSetter(js::DynamicPropertySetterContext& ctx)
 
     if(!ctx.GetValue(value)) return;
     obj->SetSyncedMetaData(ctx.GetProperty(), value);
+    ctx.GetResource()->GetMetaCache().Invalidate(obj, js::MetaCache::Type::SYNCED_META, ctx.GetProperty());
 }
 
 static void SyncedMetaDeleter(js::DynamicPropertyDeleterContext& ctx)
@@ -100,6 +103,7 @@ static void SyncedMetaDeleter(js::DynamicPropertyDeleterContext& ctx)
     }
 
     obj->DeleteSyncedMetaData(ctx.GetProperty());
+    ctx.GetResource()->GetMetaCache().Invalidate(obj, js::MetaCache::Type::SYNCED_META, ctx.GetProperty());
     ctx.Return(true);
 }
 
@@ -111,6 +115,7 @@ static void StreamSyncedMetaSetter(js::DynamicPropertySetterContext& ctx)
 
     if(!ctx.GetValue(value)) return;
     obj->SetStreamSyncedMetaData(ctx.GetProperty(), value);
+    ctx.GetResource()->GetMetaCache().Invalidate(obj, js::MetaCache::Type::STREAM_SYNCED_META, ctx.GetProperty());
 }
 
 static void StreamSyncedMetaDeleter(js::DynamicPropertyDeleterContext& ctx)
@@ -124,9 +129,60 @@ static void StreamSyncedMetaDeleter(js::DynamicPropertyDeleterContext& ctx)
     }
 
     obj->DeleteStreamSyncedMetaData(ctx.GetProperty());
+    ctx.GetResource()->GetMetaCache().Invalidate(obj, js::MetaCache::Type::STREAM_SYNCED_META, ctx.GetProperty());
     ctx.Return(true);
 }
 
+static void SetSyncedMetaBatch(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckThis()) return;
+    alt::IEntity* obj = ctx.GetThisObject<alt::IEntity>();
+    js::SetMetaBatch(ctx, "syncedMeta", obj, [&](const std::string& key, alt::MValue value) { obj->SetSyncedMetaData(key, value); });
+}
+
+static void SetStreamSyncedMetaBatch(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckThis()) return;
+    alt::IEntity* obj = ctx.GetThisObject<alt::IEntity>();
+    js::SetMetaBatch(ctx, "streamSyncedMeta", obj, [&](const std::string& key, alt::MValue value) { obj->SetStreamSyncedMetaData(key, value); });
+}
+
+static void On(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckThis()) return;
+    if(!ctx.CheckArgCount(2)) return;
+    alt::IEntity* entity = ctx.GetThisObject<alt::IEntity>();
+
+    alt::CEvent::Type type;
+    if(!ctx.GetArg(0, type)) return;
+    if(!ctx.Check(ObjectEventHandlers::IsObjectEvent(type), "Event type is not an entity event")) return;
+
+    v8::Local<v8::Value> handler;
+    if(!ctx.GetArg(1, handler, js::Type::FUNCTION)) return;
+
+    CNodeResource* resource = static_cast<CNodeResource*>(ctx.GetResource());
+    resource->GetObjectEventHandlers().Add(entity, ObjectEventHandlers::GetKey(type), handler.As<v8::Function>());
+    resource->UpdateCoreEvent(type);
+}
+
+static void Off(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckThis()) return;
+    if(!ctx.CheckArgCount(2)) return;
+    alt::IEntity* entity = ctx.GetThisObject<alt::IEntity>();
+
+    alt::CEvent::Type type;
+    if(!ctx.GetArg(0, type)) return;
+
+    v8::Local<v8::Value> handler;
+    if(!ctx.GetArg(1, handler, js::Type::FUNCTION)) return;
+
+    CNodeResource* resource = static_cast<CNodeResource*>(ctx.GetResource());
+    bool removed = resource->GetObjectEventHandlers().Remove(entity, ObjectEventHandlers::GetKey(type), handler.As<v8::Function>());
+    if(removed) resource->UpdateCoreEvent(type);
+    ctx.Return(removed);
+}
+
 // clang-format off
 extern js::Class sharedEntityClass;
 extern js::Class entityClass("Entity", &sharedEntityClass, nullptr, [](js::ClassTemplate& tpl)
@@ -137,6 +193,9 @@ extern js::Class entityClass("Entity", &sharedEntityClass, nullptr, [](js::Class
     tpl.Method("attachTo", &AttachTo);
     tpl.Method<&alt::IEntity::Detach>("detach");
 
+    tpl.Method("on", On);
+    tpl.Method("off", Off);
+
     tpl.Property<&alt::IEntity::GetVisible, &alt::IEntity::SetVisible>("visible");
     tpl.Property<&alt::IEntity::GetStreamed, &alt::IEntity::SetStreamed>("streamed");
     tpl.Property<&alt::IEntity::IsFrozen, &alt::IEntity::SetFrozen>("frozen");
@@ -144,6 +203,8 @@ extern js::Class entityClass("Entity", &sharedEntityClass, nullptr, [](js::Class
 
     tpl.DynamicProperty("syncedMeta", nullptr, SyncedMetaSetter, SyncedMetaDeleter, nullptr);
     tpl.DynamicProperty("streamSyncedMeta", nullptr, StreamSyncedMetaSetter, StreamSyncedMetaDeleter, nullptr);
+    tpl.Method("setSyncedMetaBatch", SetSyncedMetaBatch);
+    tpl.Method("setStreamSyncedMetaBatch", SetStreamSyncedMetaBatch);
 
     tpl.StaticFunction("getByID", &GetByID);
 });
@@ -1,6 +1,7 @@
 #include "Class.h"
 #include "interfaces/IResource.h"
 #include "cpp-sdk/ICore.h"
+#include "helpers/MetaBatch.h"
 
 static void GetByID(js::FunctionContext& ctx)
 {
@@ -435,7 +436,7 @@ static void LocalMetaGetter(js::DynamicPropertyGetterContext& ctx)
     if(!ctx.CheckParent()) return;
     alt::IPlayer* player = ctx.GetParent<alt::IPlayer>();
 
-    ctx.Return(player->GetLocalMetaData(ctx.GetProperty()));
+    js::ReturnMeta(ctx, ctx.GetResource()->GetMetaCache(), player, js::MetaCache::Type::LOCAL_META, [&]() { return player->GetLocalMetaData(ctx.GetProperty()); });
 }
 
 static void LocalMetaSetter(js::DynamicPropertySetterContext& ctx)
@@ -447,6 +448,14 @@ static void LocalMetaSetter(js::DynamicPropertySetterContext& ctx)
     if(!ctx.GetValue(value)) return;
 
     player->SetLocalMetaData(ctx.GetProperty(), value);
+    ctx.GetResource()->GetMetaCache().Invalidate(player, js::MetaCache::Type::LOCAL_META, ctx.GetProperty());
+}
+
+static void SetLocalMetaBatch(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckThis()) return;
+    alt::IPlayer* player = ctx.GetThisObject<alt::IPlayer>();
+    js::SetMetaBatch(ctx, "localMeta", player, [&](const std::string& key, alt::MValue value) { player->SetLocalMetaData(key, value); });
 }
 
 static void LocalMetaDeleter(js::DynamicPropertyDeleterContext& ctx)
@@ -461,6 +470,7 @@ static void LocalMetaDeleter(js::DynamicPropertyDeleterContext& ctx)
     }
 
     player->DeleteLocalMetaData(ctx.GetProperty());
+    ctx.GetResource()->GetMetaCache().Invalidate(player, js::MetaCache::Type::LOCAL_META, ctx.GetProperty());
     ctx.Return(true);
 }
 
@@ -543,6 +553,7 @@ extern js::Class playerClass("Player", &sharedPlayerClass, nullptr, [](js::Class
     tpl.Method<&alt::IPlayer::ClearTasks>("clearTasks");
 
     tpl.DynamicProperty("localMeta", LocalMetaGetter, LocalMetaSetter, LocalMetaDeleter, LocalMetaEnumerator);
+    tpl.Method("setLocalMetaBatch", SetLocalMetaBatch);
 
     tpl.StaticFunction("getByID", &GetByID);
 });
@@ -0,0 +1,120 @@
+#include "Class.h"
+#include "PlayerGroup.h"
+#include "CNodeResource.h"
+#include "cpp-sdk/ICore.h"
+
+extern js::Class playerGroupClass;
+
+PlayerGroup::PlayerGroup(CNodeResource* _resource, v8::Local<v8::Object> object) : resource(_resource), handle(v8::Isolate::GetCurrent(), object)
+{
+    object->SetAlignedPointerInInternalField(1, this);
+    handle.SetWeak(this, WeakCallback, v8::WeakCallbackType::kParameter);
+    resource->AddPlayerGroup(this);
+}
+
+PlayerGroup::~PlayerGroup()
+{
+    handle.Reset();
+    resource->RemovePlayerGroup(this);
+}
+
+void PlayerGroup::WeakCallback(const v8::WeakCallbackInfo<PlayerGroup>& info)
+{
+    delete info.GetParameter();
+}
+
+PlayerGroup* PlayerGroup::Get(v8::Local<v8::Value> value)
+{
+    if(!value->IsObject()) return nullptr;
+    v8::Local<v8::Object> obj = value.As<v8::Object>();
+    if(obj->InternalFieldCount() != 2) return nullptr;
+    if(!playerGroupClass.GetTemplate(v8::Isolate::GetCurrent()).Get()->HasInstance(obj)) return nullptr;
+    return static_cast<PlayerGroup*>(obj->GetAlignedPointerFromInternalField(1));
+}
+
+static void Ctor(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckCtor()) return;
+    if(!ctx.CheckArgCount(0, 1)) return;
+
+    std::vector<alt::IPlayer*> players;
+    if(ctx.GetArgCount() == 1 && !ctx.GetArg(0, players)) return;
+
+    PlayerGroup* group = new PlayerGroup(static_cast<CNodeResource*>(ctx.GetResource()), ctx.GetThis());
+    for(alt::IPlayer* player : players)
+    {
+        if(player) group->Add(player);
+    }
+}
+
+static void Add(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    if(!ctx.CheckArgCount(1)) return;
+    PlayerGroup* group = ctx.GetExtraInternalFieldValue<PlayerGroup>();
+
+    alt::IPlayer* player;
+    if(!ctx.GetArg(0, player)) return;
+
+    ctx.Return(group->Add(player));
+}
+
+static void Remove(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    if(!ctx.CheckArgCount(1)) return;
+    PlayerGroup* group = ctx.GetExtraInternalFieldValue<PlayerGroup>();
+
+    alt::IPlayer* player;
+    if(!ctx.GetArg(0, player)) return;
+
+    ctx.Return(group->Remove(player));
+}
+
+static void Has(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    if(!ctx.CheckArgCount(1)) return;
+    PlayerGroup* group = ctx.GetExtraInternalFieldValue<PlayerGroup>();
+
+    alt::IPlayer* player;
+    if(!ctx.GetArg(0, player)) return;
+
+    ctx.Return(group->Has(player));
+}
+
+static void Clear(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    PlayerGroup* group = ctx.GetExtraInternalFieldValue<PlayerGroup>();
+
+    group->Clear();
+}
+
+static void PlayersGetter(js::PropertyContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    PlayerGroup* group = ctx.GetExtraInternalFieldValue<PlayerGroup>();
+
+    ctx.Return(group->GetPlayers());
+}
+
+static void SizeGetter(js::PropertyContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    PlayerGroup* group = ctx.GetExtraInternalFieldValue<PlayerGroup>();
+
+    ctx.Return((uint32_t)group->GetPlayers().size());
+}
+
+// clang-format off
+extern js::Class playerGroupClass("PlayerGroup", Ctor, [](js::ClassTemplate& tpl)
+{
+    tpl.Method("add", Add);
+    tpl.Method("remove", Remove);
+    tpl.Method("has", Has);
+    tpl.Method("clear", Clear);
+
+    tpl.Property("players", PlayersGetter);
+    tpl.Property("size", SizeGetter);
+}, true);
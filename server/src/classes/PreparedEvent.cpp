@@ -0,0 +1,112 @@
+#include "Class.h"
+#include "PreparedEvent.h"
+#include "cpp-sdk/ICore.h"
+
+extern js::Class preparedEventClass;
+
+static size_t GetMValueSize(alt::MValueConst val)
+{
+    // Type tag + payload, lengths are counted as 4 bytes
+    switch(val->GetType())
+    {
+        case alt::IMValue::Type::NONE:
+        case alt::IMValue::Type::NIL: return 1;
+        case alt::IMValue::Type::BOOL: return 2;
+        case alt::IMValue::Type::INT:
+        case alt::IMValue::Type::UINT:
+        case alt::IMValue::Type::DOUBLE: return 9;
+        case alt::IMValue::Type::STRING: return 5 + std::dynamic_pointer_cast<const alt::IMValueString>(val)->Value().size();
+        case alt::IMValue::Type::LIST:
+        {
+            alt::MValueListConst list = std::dynamic_pointer_cast<const alt::IMValueList>(val);
+            size_t size = 5;
+            for(uint32_t i = 0; i < list->GetSize(); ++i) size += GetMValueSize(list->Get(i));
+            return size;
+        }
+        case alt::IMValue::Type::DICT:
+        {
+            alt::MValueDictConst dict = std::dynamic_pointer_cast<const alt::IMValueDict>(val);
+            size_t size = 5;
+            for(auto it = dict->Begin(); it; it = dict->Next()) size += 4 + it->GetKey().size() + GetMValueSize(it->GetValue());
+            return size;
+        }
+        case alt::IMValue::Type::BASE_OBJECT: return 6;
+        case alt::IMValue::Type::VECTOR3: return 13;
+        case alt::IMValue::Type::VECTOR2: return 9;
+        case alt::IMValue::Type::RGBA: return 5;
+        case alt::IMValue::Type::BYTE_ARRAY: return 5 + std::dynamic_pointer_cast<const alt::IMValueByteArray>(val)->GetSize();
+        default: break;
+    }
+    return 1;
+}
+
+PreparedEvent::PreparedEvent(v8::Local<v8::Object> object, const std::string& _eventName, const alt::MValueArgs& _args)
+    : handle(v8::Isolate::GetCurrent(), object), eventName(_eventName), args(_args), size(5 + _eventName.size())
+{
+    for(const alt::MValueConst& arg : args) size += GetMValueSize(arg);
+    object->SetAlignedPointerInInternalField(1, this);
+    handle.SetWeak(this, WeakCallback, v8::WeakCallbackType::kParameter);
+}
+
+void PreparedEvent::WeakCallback(const v8::WeakCallbackInfo<PreparedEvent>& info)
+{
+    delete info.GetParameter();
+}
+
+v8::Local<v8::Object> PreparedEvent::Create(v8::Local<v8::Context> context, const std::string& eventName, const alt::MValueArgs& args)
+{
+    v8::Local<v8::Object> obj = preparedEventClass.Create(context);
+    new PreparedEvent(obj, eventName, args);
+    return obj;
+}
+
+PreparedEvent* PreparedEvent::Get(v8::Local<v8::Value> value)
+{
+    if(!value->IsObject()) return nullptr;
+    v8::Local<v8::Object> obj = value.As<v8::Object>();
+    if(obj->InternalFieldCount() != 2) return nullptr;
+    if(!preparedEventClass.GetTemplate(v8::Isolate::GetCurrent()).Get()->HasInstance(obj)) return nullptr;
+    return static_cast<PreparedEvent*>(obj->GetAlignedPointerFromInternalField(1));
+}
+
+bool GetEventMessage(js::FunctionContext& ctx, int index, EventMessage& message)
+{
+    v8::Local<v8::Value> value;
+    if(!ctx.GetArg(index, value)) return false;
+    message.prepared = PreparedEvent::Get(value);
+    if(message.prepared) return ctx.Check(ctx.GetArgCount() == index + 1, "Prepared events can't be emitted with additional arguments");
+
+    if(!ctx.GetArg(index, message.eventName)) return false;
+
+    message.args.reserve(ctx.GetArgCount() - index - 1);
+    alt::MValue val;
+    for(int i = index + 1; i < ctx.GetArgCount(); i++)
+    {
+        if(!ctx.GetArg(i, val)) continue;
+        message.args.push_back(val);
+    }
+    return true;
+}
+
+static void EventNameGetter(js::LazyPropertyContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    PreparedEvent* event = ctx.GetExtraInternalFieldValue<PreparedEvent>();
+
+    ctx.Return(event->GetEventName());
+}
+
+static void SizeGetter(js::LazyPropertyContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    PreparedEvent* event = ctx.GetExtraInternalFieldValue<PreparedEvent>();
+
+    ctx.Return((double)event->GetSize());
+}
+
+// clang-format off
+extern js::Class preparedEventClass("PreparedEvent", nullptr, [](js::ClassTemplate& tpl)
+{
+    tpl.LazyProperty("eventName", EventNameGetter);
+    tpl.LazyProperty("size", SizeGetter);
+}, true);
@@ -0,0 +1,74 @@
+#include "Class.h"
+#include "PlayerGroup.h"
+#include "PreparedEvent.h"
+#include "CNodeResource.h"
+#include "cpp-sdk/ICore.h"
+
+static void Ctor(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckCtor()) return;
+    if(!ctx.CheckArgCount(0)) return;
+
+    new PlayerGroup(static_cast<CNodeResource*>(ctx.GetResource()), ctx.GetThis());
+}
+
+static void Emit(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    if(!ctx.CheckArgCount(1, 32)) return;
+    PlayerGroup* group = ctx.GetExtraInternalFieldValue<PlayerGroup>();
+
+    EventMessage message;
+    if(!GetEventMessage(ctx, 0, message)) return;
+    if(group->GetPlayers().empty()) return;
+
+    alt::ICore::Instance().TriggerClientEvent(group->GetPlayers(), message.GetEventName(), message.GetArgs());
+}
+
+static void EmitUnreliable(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    if(!ctx.CheckArgCount(1, 32)) return;
+    PlayerGroup* group = ctx.GetExtraInternalFieldValue<PlayerGroup>();
+
+    EventMessage message;
+    if(!GetEventMessage(ctx, 0, message)) return;
+    if(group->GetPlayers().empty()) return;
+
+    alt::ICore::Instance().TriggerClientEventUnreliable(group->GetPlayers(), message.GetEventName(), message.GetArgs());
+}
+
+// Subscribing is the same as adding to the player group, the aliases are only for readability
+static void Subscribe(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    if(!ctx.CheckArgCount(1)) return;
+    PlayerGroup* group = ctx.GetExtraInternalFieldValue<PlayerGroup>();
+
+    alt::IPlayer* player;
+    if(!ctx.GetArg(0, player)) return;
+
+    ctx.Return(group->Add(player));
+}
+
+static void Unsubscribe(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckExtraInternalFieldValue()) return;
+    if(!ctx.CheckArgCount(1)) return;
+    PlayerGroup* group = ctx.GetExtraInternalFieldValue<PlayerGroup>();
+
+    alt::IPlayer* player;
+    if(!ctx.GetArg(0, player)) return;
+
+    ctx.Return(group->Remove(player));
+}
+
+// clang-format off
+extern js::Class playerGroupClass;
+extern js::Class topicClass("Topic", &playerGroupClass, Ctor, [](js::ClassTemplate& tpl)
+{
+    tpl.Method("subscribe", Subscribe);
+    tpl.Method("unsubscribe", Unsubscribe);
+    tpl.Method("emit", Emit);
+    tpl.Method("emitUnreliable", EmitUnreliable);
+}, true);
@@ -1,5 +1,6 @@
 #include "Class.h"
 #include "cpp-sdk/ICore.h"
+#include "helpers/MetaBatch.h"
 
 static void StreamSyncedMetaSetter(js::DynamicPropertySetterContext& ctx)
 {
@@ -27,6 +28,13 @@ static void StreamSyncedMetaDeleter(js::DynamicPropertyDeleterContext& ctx)
     ctx.Return(true);
 }
 
+static void SetStreamSyncedMetaBatch(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckThis()) return;
+    alt::IVirtualEntity* obj = ctx.GetThisObject<alt::IVirtualEntity>();
+    js::SetMetaBatch(ctx, "streamSyncedMeta", obj, [&](const std::string& key, alt::MValue value) { obj->SetStreamSyncedMetaData(key, value); });
+}
+
 // clang-format off
 extern js::Class sharedVirtualEntityClass;
 extern js::Class virtualEntityClass("VirtualEntity", &sharedVirtualEntityClass, nullptr, [](js::ClassTemplate& tpl)
@@ -34,4 +42,5 @@ extern js::Class virtualEntityClass("VirtualEntity", &sharedVirtualEntityClass,
     tpl.BindToType(alt::IBaseObject::Type::VIRTUAL_ENTITY);
 
     tpl.DynamicProperty("streamSyncedMeta", nullptr, StreamSyncedMetaSetter, StreamSyncedMetaDeleter, nullptr);
+    tpl.Method("setStreamSyncedMetaBatch", SetStreamSyncedMetaBatch);
 });
@@ -1,5 +1,6 @@
 #include "Module.h"
 #include "Namespace.h"
+#include "helpers/MetaBatch.h"
 
 static void NetTimeGetter(js::PropertyContext& ctx)
 {
@@ -8,7 +9,7 @@ static void NetTimeGetter(js::PropertyContext& ctx)
 
 static void SyncedMetaGetter(js::DynamicPropertyGetterContext& ctx)
 {
-    ctx.Return(alt::ICore::Instance().GetSyncedMetaData(ctx.GetProperty()));
+    js::ReturnMeta(ctx, ctx.GetResource()->GetMetaCache(), nullptr, js::MetaCache::Type::GLOBAL_SYNCED_META, [&]() { return alt::ICore::Instance().GetSyncedMetaData(ctx.GetProperty()); });
 }
 
 static void SyncedMetaSetter(js::DynamicPropertySetterContext& ctx)
@@ -16,6 +17,7 @@ static void SyncedMetaSetter(js::DynamicPropertySetterContext& ctx)
     alt::MValue value;
     if(!ctx.GetValue(value)) return;
     alt::ICore::Instance().SetSyncedMetaData(ctx.GetProperty(), value);
+    ctx.GetResource()->GetMetaCache().Invalidate(nullptr, js::MetaCache::Type::GLOBAL_SYNCED_META, ctx.GetProperty());
 }
 
 static void SyncedMetaDeleter(js::DynamicPropertyDeleterContext& ctx)
@@ -27,6 +29,7 @@ static void SyncedMetaDeleter(js::DynamicPropertyDeleterContext& ctx)
     }
 
     alt::ICore::Instance().DeleteSyncedMetaData(ctx.GetProperty());
+    ctx.GetResource()->GetMetaCache().Invalidate(nullptr, js::MetaCache::Type::GLOBAL_SYNCED_META, ctx.GetProperty());
     ctx.Return(true);
 }
 
@@ -35,6 +38,11 @@ static void SyncedMetaEnumerator(js::DynamicPropertyEnumeratorContext& ctx)
     ctx.Return(alt::ICore::Instance().GetSyncedMetaDataKeys());
 }
 
+static void SetSyncedMetaBatch(js::FunctionContext& ctx)
+{
+    js::SetMetaBatch(ctx, "globalSyncedMeta", nullptr, [](const std::string& key, alt::MValue value) { alt::ICore::Instance().SetSyncedMetaData(key, value); });
+}
+
 static void GetServerConfig(js::LazyPropertyContext& ctx)
 {
     Config::Value::ValuePtr config = alt::ICore::Instance().GetServerConfig();
@@ -136,9 +144,9 @@ static void GetClosestEntities(js::FunctionContext& ctx)
 }
 
 // clang-format off
-extern js::Class playerClass, vehicleClass, colShapeClass, checkpointClass, pedClass, networkObjectClass, voiceChannelClass, blipClass, virtualEntityClass, virtualEntityGroupClass;
+extern js::Class playerClass, vehicleClass, colShapeClass, checkpointClass, pedClass, networkObjectClass, voiceChannelClass, blipClass, virtualEntityClass, virtualEntityGroupClass, playerGroupClass;
 extern js::Namespace eventsNamespace, pedModelInfoNamespace, vehicleModelInfoNamespace;
-static js::Module altModule("alt", "alt-shared", { &playerClass, &vehicleClass, &colShapeClass, &checkpointClass, &pedClass, &networkObjectClass, &voiceChannelClass, &blipClass, &virtualEntityClass, &virtualEntityGroupClass }, [](js::ModuleTemplate& module)
+static js::Module altModule("alt", "alt-shared", { &playerClass, &vehicleClass, &colShapeClass, &checkpointClass, &pedClass, &networkObjectClass, &voiceChannelClass, &blipClass, &virtualEntityClass, &virtualEntityGroupClass, &playerGroupClass }, [](js::ModuleTemplate& module)
 {
     module.StaticProperty("isClient", false);
     module.StaticProperty("isServer", true);
@@ -148,6 +156,7 @@ static js::Module altModule("alt", "alt-shared", { &playerClass, &vehicleClass,
     module.StaticProperty("globalDimension", alt::GLOBAL_DIMENSION);
 
     module.StaticDynamicProperty("syncedMeta", SyncedMetaGetter, SyncedMetaSetter, SyncedMetaDeleter, SyncedMetaEnumerator);
+    module.StaticFunction("setSyncedMetaBatch", SetSyncedMetaBatch);
 
     module.StaticLazyProperty("serverConfig", GetServerConfig);
 
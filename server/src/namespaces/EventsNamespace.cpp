@@ -1,64 +1,129 @@
 #include "Namespace.h"
+#include "Class.h"
+#include "PlayerGroup.h"
+#include "PreparedEvent.h"
+#include "CNodeResource.h"
 
-static void EmitPlayers(js::FunctionContext& ctx)
+// Player groups are used directly, arrays are converted into the buffer
+static const std::vector<alt::IPlayer*>* GetPlayersArg(js::FunctionContext& ctx, int index, std::vector<alt::IPlayer*>& buffer)
 {
-    if(!ctx.CheckArgCount(2, 32)) return;
+    v8::Local<v8::Value> value;
+    if(!ctx.GetArg(index, value)) return nullptr;
+    PlayerGroup* group = PlayerGroup::Get(value);
+    if(group) return &group->GetPlayers();
 
     js::Array playersArr;
-    if(!ctx.GetArg(0, playersArr)) return;
-    std::vector<alt::IPlayer*> players;
-    players.reserve(playersArr.Length());
+    if(!ctx.GetArg(index, playersArr, js::Type::ARRAY)) return nullptr;
+    buffer.reserve(playersArr.Length());
     for(int i = 0; i < playersArr.Length(); i++)
     {
         alt::IPlayer* player = playersArr.Get<alt::IPlayer*>(i);
         if(!player) continue;
-        players.push_back(player);
+        buffer.push_back(player);
     }
+    return &buffer;
+}
 
-    std::string eventName;
-    if(!ctx.GetArg(1, eventName)) return;
+static void EmitPlayers(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(2, 32)) return;
 
-    alt::MValueArgs args;
-    args.reserve(ctx.GetArgCount() - 2);
-    alt::MValue val;
-    for(int i = 2; i < ctx.GetArgCount(); i++)
-    {
-        if(!ctx.GetArg(i, val)) continue;
-        args.push_back(val);
-    }
-    alt::ICore::Instance().TriggerClientEvent(players, eventName, args);
+    std::vector<alt::IPlayer*> playersBuffer;
+    const std::vector<alt::IPlayer*>* players = GetPlayersArg(ctx, 0, playersBuffer);
+    if(!players) return;
+
+    EventMessage message;
+    if(!GetEventMessage(ctx, 1, message)) return;
+
+    alt::ICore::Instance().TriggerClientEvent(*players, message.GetEventName(), message.GetArgs());
 }
 
 static void EmitPlayersUnreliable(js::FunctionContext& ctx)
 {
     if(!ctx.CheckArgCount(2, 32)) return;
 
-    js::Array playersArr;
-    if(!ctx.GetArg(0, playersArr)) return;
-    std::vector<alt::IPlayer*> players;
-    players.reserve(playersArr.Length());
-    for(int i = 0; i < playersArr.Length(); i++)
-    {
-        alt::IPlayer* player = playersArr.Get<alt::IPlayer*>(i);
-        if(!player) continue;
-        players.push_back(player);
-    }
+    std::vector<alt::IPlayer*> playersBuffer;
+    const std::vector<alt::IPlayer*>* players = GetPlayersArg(ctx, 0, playersBuffer);
+    if(!players) return;
 
-    std::string eventName;
-    if(!ctx.GetArg(1, eventName)) return;
+    EventMessage message;
+    if(!GetEventMessage(ctx, 1, message)) return;
 
-    alt::MValueArgs args;
-    args.reserve(ctx.GetArgCount() - 2);
-    alt::MValue val;
-    for(int i = 2; i < ctx.GetArgCount(); i++)
+    alt::ICore::Instance().TriggerClientEventUnreliable(*players, message.GetEventName(), message.GetArgs());
+}
+
+static void EmitAllPlayers(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(1, 32)) return;
+
+    EventMessage message;
+    if(!GetEventMessage(ctx, 0, message)) return;
+
+    alt::ICore::Instance().TriggerClientEventForAll(message.GetEventName(), message.GetArgs());
+}
+
+static void EmitAllPlayersUnreliable(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(1, 32)) return;
+
+    EventMessage message;
+    if(!GetEventMessage(ctx, 0, message)) return;
+
+    alt::ICore::Instance().TriggerClientEventUnreliableForAll(message.GetEventName(), message.GetArgs());
+}
+
+// Selects the players natively, so the players don't have to be filtered in JS
+static bool GetPlayersInRange(js::FunctionContext& ctx, std::vector<alt::IPlayer*>& players)
+{
+    alt::Vector3f pos;
+    if(!ctx.GetArg(0, pos)) return false;
+
+    int32_t range;
+    if(!ctx.GetArg(1, range)) return false;
+
+    uint32_t dimension;
+    if(!ctx.GetArg(2, dimension)) return false;
+
+    constexpr uint64_t playerType = 1ull << (uint64_t)alt::IBaseObject::Type::PLAYER;
+    std::vector<alt::IBaseObject*> entities = alt::ICore::Instance().GetEntitiesInRange(pos, range, dimension, playerType);
+    players.reserve(entities.size());
+    for(alt::IBaseObject* entity : entities)
     {
-        if(!ctx.GetArg(i, val)) continue;
-        args.push_back(val);
+        alt::IPlayer* player = dynamic_cast<alt::IPlayer*>(entity);
+        if(player) players.push_back(player);
     }
-    alt::ICore::Instance().TriggerClientEventUnreliable(players, eventName, args);
+    return true;
 }
 
-static void EmitAllPlayers(js::FunctionContext& ctx)
+static void EmitInRange(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(4, 32)) return;
+
+    std::vector<alt::IPlayer*> players;
+    if(!GetPlayersInRange(ctx, players)) return;
+
+    EventMessage message;
+    if(!GetEventMessage(ctx, 3, message)) return;
+    if(players.empty()) return;
+
+    alt::ICore::Instance().TriggerClientEvent(players, message.GetEventName(), message.GetArgs());
+}
+
+static void EmitInRangeUnreliable(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(4, 32)) return;
+
+    std::vector<alt::IPlayer*> players;
+    if(!GetPlayersInRange(ctx, players)) return;
+
+    EventMessage message;
+    if(!GetEventMessage(ctx, 3, message)) return;
+    if(players.empty()) return;
+
+    alt::ICore::Instance().TriggerClientEventUnreliable(players, message.GetEventName(), message.GetArgs());
+}
+
+static void Prepare(js::FunctionContext& ctx)
 {
     if(!ctx.CheckArgCount(1, 32)) return;
 
@@ -73,32 +138,73 @@ static void EmitAllPlayers(js::FunctionContext& ctx)
         if(!ctx.GetArg(i, val)) continue;
         args.push_back(val);
     }
-    alt::ICore::Instance().TriggerClientEventForAll(eventName, args);
+    ctx.Return(PreparedEvent::Create(ctx.GetContext(), eventName, args));
 }
 
-static void EmitAllPlayersUnreliable(js::FunctionContext& ctx)
+static void SetClientRateLimit(js::FunctionContext& ctx)
 {
-    if(!ctx.CheckArgCount(1, 32)) return;
+    if(!ctx.CheckArgCount(2, 3)) return;
 
     std::string eventName;
     if(!ctx.GetArg(0, eventName)) return;
 
-    alt::MValueArgs args;
-    args.reserve(ctx.GetArgCount() - 1);
-    alt::MValue val;
-    for(int i = 1; i < ctx.GetArgCount(); i++)
+    double perSecond;
+    if(!ctx.GetArg(1, perSecond)) return;
+    if(!ctx.Check(perSecond > 0, "Events per second has to be greater than 0")) return;
+
+    double burst = perSecond;
+    if(ctx.GetArgCount() == 3 && !ctx.GetArg(2, burst)) return;
+    if(!ctx.Check(burst >= 1, "Burst has to be at least 1")) return;
+
+    static_cast<CNodeResource*>(ctx.GetResource())->GetClientEventRateLimiter().SetLimit(eventName, perSecond, burst);
+}
+
+static void RemoveClientRateLimit(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(1)) return;
+
+    std::string eventName;
+    if(!ctx.GetArg(0, eventName)) return;
+
+    static_cast<CNodeResource*>(ctx.GetResource())->GetClientEventRateLimiter().RemoveLimit(eventName);
+}
+
+static void GetClientRateLimitStats(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(0, 1)) return;
+    ClientEventRateLimiter& limiter = static_cast<CNodeResource*>(ctx.GetResource())->GetClientEventRateLimiter();
+
+    if(ctx.GetArgCount() == 1)
     {
-        if(!ctx.GetArg(i, val)) continue;
-        args.push_back(val);
+        alt::IPlayer* player;
+        if(!ctx.GetArg(0, player)) return;
+        ctx.Return((double)limiter.GetDropCount(player));
+        return;
     }
-    alt::ICore::Instance().TriggerClientEventUnreliableForAll(eventName, args);
+
+    js::Object events;
+    for(auto& [eventName, limit] : limiter.GetLimits()) events.Set(eventName, (double)limit.dropped);
+
+    js::Object stats;
+    stats.Set("dropped", (double)limiter.GetDropCount());
+    stats.Set("events", events);
+    ctx.Return(stats);
 }
 
 // clang-format off
+extern js::Class topicClass;
 extern js::Namespace sharedEventsNamespace;
 extern js::Namespace eventsNamespace("Events", &sharedEventsNamespace, [](js::NamespaceTemplate& tpl) {
+    tpl.StaticProperty("Topic", topicClass.GetTemplate(tpl.GetIsolate()).Get());
+
     tpl.StaticFunction("emitPlayers", &EmitPlayers);
     tpl.StaticFunction("emitPlayersUnreliable", &EmitPlayersUnreliable);
     tpl.StaticFunction("emitAllPlayers", &EmitAllPlayers);
     tpl.StaticFunction("emitAllPlayersUnreliable", &EmitAllPlayersUnreliable);
+    tpl.StaticFunction("emitInRange", &EmitInRange);
+    tpl.StaticFunction("emitInRangeUnreliable", &EmitInRangeUnreliable);
+    tpl.StaticFunction("prepare", &Prepare);
+    tpl.StaticFunction("setClientRateLimit", &SetClientRateLimit);
+    tpl.StaticFunction("removeClientRateLimit", &RemoveClientRateLimit);
+    tpl.StaticFunction("getClientRateLimitStats", &GetClientRateLimitStats);
 });
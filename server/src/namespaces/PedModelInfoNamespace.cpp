@@ -1,4 +1,6 @@
 #include "Namespace.h"
+#include "CNodeResource.h"
+#include "helpers/MetaCache.h"
 
 static void Get(js::FunctionContext& ctx)
 {
@@ -7,6 +9,14 @@ static void Get(js::FunctionContext& ctx)
     uint32_t model;
     if(!ctx.GetArgAsHash(0, model)) return;
 
+    CNodeResource* resource = static_cast<CNodeResource*>(ctx.GetResource());
+    v8::Local<v8::Object> cached = resource->GetPedModelInfo(model);
+    if(!cached.IsEmpty())
+    {
+        ctx.Return(cached);
+        return;
+    }
+
     const alt::PedModelInfo& info = alt::ICore::Instance().GetPedModelByHash(model);
     if(!ctx.Check(info.hash != 0, "Invalid ped model")) return;
 
@@ -28,6 +38,8 @@ static void Get(js::FunctionContext& ctx)
     }
     modelObj.Set("bones", bones);
 
+    js::DeepFreeze(ctx.GetContext(), modelObj.Get());
+    resource->SetPedModelInfo(model, modelObj.Get());
     ctx.Return(modelObj);
 }
 
@@ -1,31 +1,40 @@
 #include "Namespace.h"
+#include "CNodeResource.h"
+#include "helpers/MetaCache.h"
 
-static void DoesExtraExist(js::FunctionContext& ctx)
+// Gets the model info the object was created for from the cache of the resource
+static const alt::VehicleModelInfo* GetThisModelInfo(js::FunctionContext& ctx)
 {
-    if(!ctx.CheckArgCount(1)) return;
     js::Object thisObj = ctx.GetThis();
     uint32_t model = thisObj.Get<uint32_t>("model");
-    const alt::VehicleModelInfo& info = alt::ICore::Instance().GetVehicleModelByHash(model);
-    if(!ctx.Check(info.modelType != alt::VehicleModelInfo::Type::INVALID, "Invalid vehicle model")) return;
+    const alt::VehicleModelInfo* info = nullptr;
+    static_cast<CNodeResource*>(ctx.GetResource())->GetVehicleModelInfo(model, &info);
+    if(!ctx.Check(info != nullptr, "Invalid vehicle model")) return nullptr;
+    return info;
+}
+
+static void DoesExtraExist(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(1)) return;
+    const alt::VehicleModelInfo* info = GetThisModelInfo(ctx);
+    if(!info) return;
 
     uint8_t extraId;
     if(!ctx.GetArg(0, extraId)) return;
 
-    ctx.Return(info.DoesExtraExist(extraId));
+    ctx.Return(info->DoesExtraExist(extraId));
 }
 
 static void IsExtraDefault(js::FunctionContext& ctx)
 {
     if(!ctx.CheckArgCount(1)) return;
-    js::Object thisObj = ctx.GetThis();
-    uint32_t model = thisObj.Get<uint32_t>("model");
-    const alt::VehicleModelInfo& info = alt::ICore::Instance().GetVehicleModelByHash(model);
-    if(!ctx.Check(info.modelType != alt::VehicleModelInfo::Type::INVALID, "Invalid vehicle model")) return;
+    const alt::VehicleModelInfo* info = GetThisModelInfo(ctx);
+    if(!info) return;
 
     uint8_t extraId;
     if(!ctx.GetArg(0, extraId)) return;
 
-    ctx.Return(info.DoesExtraDefault(extraId));
+    ctx.Return(info->DoesExtraDefault(extraId));
 }
 
 static void Get(js::FunctionContext& ctx)
@@ -35,11 +44,17 @@ static void Get(js::FunctionContext& ctx)
     uint32_t model;
     if(!ctx.GetArgAsHash(0, model)) return;
 
+    CNodeResource* resource = static_cast<CNodeResource*>(ctx.GetResource());
+    v8::Local<v8::Object> cached = resource->GetVehicleModelInfo(model);
+    if(!cached.IsEmpty())
+    {
+        ctx.Return(cached);
+        return;
+    }
+
     const alt::VehicleModelInfo& info = alt::ICore::Instance().GetVehicleModelByHash(model);
     if(!ctx.Check(info.modelType != alt::VehicleModelInfo::Type::INVALID, "Invalid vehicle model")) return;
 
-    v8::Local<v8::Context> context = ctx.GetContext();
-
     js::Object modelObj;
     modelObj.Set("model", model);
     modelObj.Set("title", info.title);
@@ -74,6 +89,8 @@ static void Get(js::FunctionContext& ctx)
     modelObj.SetMethod("doesExtraExist", DoesExtraExist);
     modelObj.SetMethod("isExtraDefault", IsExtraDefault);
 
+    js::DeepFreeze(ctx.GetContext(), modelObj.Get());
+    resource->SetVehicleModelInfo(model, &info, modelObj.Get());
     ctx.Return(modelObj);
 }
 
@@ -1,17 +1,19 @@
 /** @type {typeof import("./utils.js")} */
-const { assert } = requireBinding("shared/utils.js");
+const { assert, formatSourceLocation } = requireBinding("shared/utils.js");
 
 export class Event {
-    /** @type {Map<number, ({ handler: Function, location: { fileName: string, lineNumber: number } })[]>} */
+    /** @type {Map<number, ({ handler: Function, location: number })[]>} */
     static #handlers = new Map();
-    /** @type {Map<number, ({ handler: Function, location: { fileName: string, lineNumber: number } })[]>} */
+    /** @type {Map<number, ({ handler: Function, location: number })[]>} */
     static #customHandlers = new Map();
-    /** @type {Set<({ handler: Function, location: { fileName: string, lineNumber: number } })>} */
+    /** @type {Set<({ handler: Function, location: number })>} */
     static #genericHandlers = new Set();
+    /** @type {Map<number, (state: boolean) => void>} */
+    static #customEventToggles = new Map();
 
-    /** @type {Map<string, ({ handler: Function, location: { fileName: string, lineNumber: number } })[]>} */
+    /** @type {Map<string, ({ handler: Function, location: number })[]>} */
     static #localScriptEventHandlers = new Map();
-    /** @type {Map<string, ({ handler: Function, location: { fileName: string, lineNumber: number } })[]>} */
+    /** @type {Map<string, ({ handler: Function, location: number })[]>} */
     static #remoteScriptEventHandlers = new Map();
 
     /** Warning threshold in ms */
@@ -36,7 +38,7 @@ export class Event {
     static async #registerCallback(name, type, custom, handler) {
         assert(typeof handler === "function", `Handler for event '${name}' is not a function`);
 
-        const location = cppBindings.getCurrentSourceLocation(Event.#sourceLocationFrameSkipCount);
+        const location = cppBindings.captureSourceLocation(Event.#sourceLocationFrameSkipCount);
         const handlerObj = {
             handler,
             location,
@@ -46,6 +48,7 @@ export class Event {
         else map.get(type).push(handlerObj);
 
         if (!custom) cppBindings.toggleEvent(type, true);
+        else Event.#customEventToggles.get(type)?.(true);
     }
 
     /**
@@ -65,6 +68,7 @@ export class Event {
         handlers.splice(idx, 1);
 
         if (!custom) cppBindings.toggleEvent(type, false);
+        else Event.#customEventToggles.get(type)?.(false);
     }
 
     /**
@@ -83,17 +87,17 @@ export class Event {
                 const duration = Date.now() - startTime;
                 if (duration > Event.#warningThreshold) {
                     alt.logWarning(
-                        `[JS] Event handler in resource '${cppBindings.resourceName}' (${location.fileName}:${
-                            location.lineNumber
-                        }) for script event '${name}' took ${duration}ms to execute (Threshold: ${
+                        `[JS] Event handler in resource '${cppBindings.resourceName}' (${formatSourceLocation(location)}) for script event '${name}' took ${duration}ms to execute (Threshold: ${
                             Event.#warningThreshold
                         }ms)`
                     );
                 }
                 if (result instanceof Promise) await result;
             } catch (e) {
-                alt.logError(`[JS] Exception caught while invoking script event '${name}' handler`);
-                alt.logError(e);
+                if (cppBindings.trackError(e, location)) {
+                    alt.logError(`[JS] Exception caught while invoking script event '${name}' handler`);
+                    alt.logError(e);
+                }
             }
         }
     }
@@ -159,7 +163,7 @@ export class Event {
             `Handler for ${local ? "local" : "remote"} script event '${name}' is not a function`
         );
 
-        const location = cppBindings.getCurrentSourceLocation(Event.#sourceLocationFrameSkipCount);
+        const location = cppBindings.captureSourceLocation(Event.#sourceLocationFrameSkipCount);
         const handlerObj = {
             handler,
             location,
@@ -167,6 +171,8 @@ export class Event {
         const map = local ? Event.#localScriptEventHandlers : Event.#remoteScriptEventHandlers;
         if (!map.has(name)) map.set(name, [handlerObj]);
         else map.get(name).push(handlerObj);
+
+        cppBindings.toggleEvent(Event.#getScriptEventType(local), true);
     }
 
     static #unsubscribeScriptEvent(local, name, handler) {
@@ -182,6 +188,16 @@ export class Event {
         const idx = handlers.findIndex((value) => value.handler === handler);
         if (idx === -1) return;
         handlers.splice(idx, 1);
+
+        cppBindings.toggleEvent(Event.#getScriptEventType(local), false);
+    }
+
+    /**
+     * Script events are only sent to JS if there are handlers for them, so the handlers are counted for the event type.
+     * @param {boolean} local
+     */
+    static #getScriptEventType(local) {
+        return local === alt.isClient ? alt.Enums.EventType.CLIENT_SCRIPT_EVENT : alt.Enums.EventType.SERVER_SCRIPT_EVENT;
     }
 
     /**
@@ -216,9 +232,7 @@ export class Event {
                 const duration = Date.now() - startTime;
                 if (duration > Event.#warningThreshold) {
                     alt.logWarning(
-                        `[JS] Generic event handler in resource '${cppBindings.resourceName}' (${location.fileName}:${
-                            location.lineNumber
-                        }) for event '${Event.#getEventName(
+                        `[JS] Generic event handler in resource '${cppBindings.resourceName}' (${formatSourceLocation(location)}) for event '${Event.#getEventName(
                             eventType,
                             custom
                         )}' took ${duration}ms to execute (Threshold: ${Event.#warningThreshold}ms)`
@@ -226,8 +240,10 @@ export class Event {
                 }
                 if (result instanceof Promise) await result;
             } catch (e) {
-                alt.logError(`[JS] Exception caught while invoking generic event handler`);
-                alt.logError(e);
+                if (cppBindings.trackError(e, location)) {
+                    alt.logError(`[JS] Exception caught while invoking generic event handler`);
+                    alt.logError(e);
+                }
             }
         }
     }
@@ -235,8 +251,9 @@ export class Event {
     static subscribeGeneric(handler) {
         assert(typeof handler === "function", `Handler for generic event is not a function`);
 
-        const location = cppBindings.getCurrentSourceLocation(Event.#sourceLocationFrameSkipCount);
+        const location = cppBindings.captureSourceLocation(Event.#sourceLocationFrameSkipCount);
         Event.#genericHandlers.add({ handler, location });
+        cppBindings.setHasGenericEventHandlers(true);
     }
     static unsubscribeGeneric(handler) {
         assert(typeof handler === "function", `Handler for generic event is not a function`);
@@ -244,15 +261,18 @@ export class Event {
         Event.#genericHandlers.forEach((value) => {
             if (value.handler === handler) Event.#genericHandlers.delete(value);
         });
+        cppBindings.setHasGenericEventHandlers(Event.#genericHandlers.size > 0);
     }
 
     /**
      * @param {number} type Event type
      * @param {string} name Event name (e.g. `PlayerConnect` is accessible via `alt.Events.onPlayerConnect`)
      * @param {string} custom alt:V built-in event or a custom JS module event
+     * @param {(state: boolean) => void} [toggle] Called for custom events when a handler is added (true) or removed (false)
      */
-    static register(type, name, custom = false) {
+    static register(type, name, custom = false, toggle = undefined) {
         alt.Events[`on${name}`] = Event.#getEventFunc(name, type, custom);
+        if (custom && toggle) Event.#customEventToggles.set(type, toggle);
     }
 
     /**
@@ -275,9 +295,7 @@ export class Event {
                 const duration = Date.now() - startTime;
                 if (duration > Event.#warningThreshold) {
                     alt.logWarning(
-                        `[JS] Event handler in resource '${cppBindings.resourceName}' (${location.fileName}:${
-                            location.lineNumber
-                        }) for event '${Event.#getEventName(
+                        `[JS] Event handler in resource '${cppBindings.resourceName}' (${formatSourceLocation(location)}) for event '${Event.#getEventName(
                             eventType,
                             custom
                         )}' took ${duration}ms to execute (Threshold: ${Event.#warningThreshold}ms)`
@@ -285,8 +303,10 @@ export class Event {
                 }
                 if (result instanceof Promise) await result;
             } catch (e) {
-                alt.logError(`[JS] Exception caught while invoking event handler`);
-                alt.logError(e);
+                if (cppBindings.trackError(e, location)) {
+                    alt.logError(`[JS] Exception caught while invoking event handler`);
+                    alt.logError(e);
+                }
             }
         }
     }
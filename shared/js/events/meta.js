@@ -1,7 +1,47 @@
+/** @type {typeof import("../utils.js")} */
+const { assert } = requireBinding("shared/utils.js");
 const { Event } = requireBinding("shared/events.js");
 
-Event.register(alt.Enums.EventType.LOCAL_SYNCED_META_CHANGE, "LocalMetaChange");
-Event.register(alt.Enums.EventType.SYNCED_META_CHANGE, "SyncedMetaChange");
-Event.register(alt.Enums.EventType.STREAM_SYNCED_META_CHANGE, "StreamSyncedMetaChange");
-Event.register(alt.Enums.EventType.GLOBAL_META_CHANGE, "GlobalMetaChange");
-Event.register(alt.Enums.EventType.GLOBAL_SYNCED_META_CHANGE, "GlobalSyncedMetaChange");
+/**
+ * @param {string | string[]} keys
+ */
+function getMetaKeys(keys) {
+    if (typeof keys === "string") return [keys];
+    assert(Array.isArray(keys) && keys.every((key) => typeof key === "string"), "Expected a string or an array of strings as first argument");
+    return keys;
+}
+
+/**
+ * Registers the meta change event, which also accepts a key or an array of keys before the handler.
+ * Handlers for specific keys are filtered natively, changes of other keys are never converted for them.
+ * @param {number} type
+ * @param {string} name
+ */
+function registerMetaEvent(type, name) {
+    Event.register(type, name);
+    const eventFunc = alt.Events[`on${name}`];
+
+    const func = (keys, handler) => {
+        if (typeof keys === "function") return eventFunc(keys);
+        for (const key of getMetaKeys(keys)) cppBindings.subscribeMetaChange(type, key, handler);
+    };
+    Object.defineProperties(func, {
+        listeners: {
+            get: () => eventFunc.listeners,
+        },
+    });
+    func.remove = (keys, handler) => {
+        if (typeof keys === "function") return eventFunc.remove(keys);
+        for (const key of getMetaKeys(keys)) cppBindings.unsubscribeMetaChange(type, key, handler);
+    };
+    alt.Events[`on${name}`] = func;
+}
+
+registerMetaEvent(alt.Enums.EventType.LOCAL_SYNCED_META_CHANGE, "LocalMetaChange");
+registerMetaEvent(alt.Enums.EventType.SYNCED_META_CHANGE, "SyncedMetaChange");
+registerMetaEvent(alt.Enums.EventType.STREAM_SYNCED_META_CHANGE, "StreamSyncedMetaChange");
+registerMetaEvent(alt.Enums.EventType.GLOBAL_META_CHANGE, "GlobalMetaChange");
+registerMetaEvent(alt.Enums.EventType.GLOBAL_SYNCED_META_CHANGE, "GlobalSyncedMetaChange");
+
+// Custom event sent once by the setMetaBatch functions, listing all changed keys
+Event.register(alt.Enums.CustomEventType.META_BATCH_CHANGE, "MetaBatchChange", true);
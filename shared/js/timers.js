@@ -1,5 +1,5 @@
 /** @type {typeof import("./utils.js")} */
-const { assert } = requireBinding("shared/utils.js");
+const { assert, formatSourceLocation } = requireBinding("shared/utils.js");
 
 /** @type {Set<Timer>} */
 const timers = new Set();
@@ -25,7 +25,7 @@ class Timer {
     lastTick;
     /** @type {boolean} */
     once;
-    /** @type {{ fileName: string, lineNumber: number }} */
+    /** @type {number} Resolved with formatSourceLocation only when needed */
     location;
 
     constructor(callback, interval, once) {
@@ -36,7 +36,7 @@ class Timer {
         this.callback = callback.bind(this);
         this.lastTick = Date.now();
         this.once = once;
-        this.location = cppBindings.getCurrentSourceLocation(Timer.#sourceLocationFrameSkipCount);
+        this.location = cppBindings.captureSourceLocation(Timer.#sourceLocationFrameSkipCount);
         timers.add(this);
     }
 
@@ -50,8 +50,10 @@ class Timer {
             try {
                 this.callback();
             } catch (e) {
-                alt.logError(`[JS] Exception caught while invoking timer callback`);
-                alt.logError(e);
+                if (cppBindings.trackError(e, this.location)) {
+                    alt.logError(`[JS] Exception caught while invoking timer callback`);
+                    alt.logError(e);
+                }
             }
             this.lastTick = Date.now();
             if (this.once) this.destroy();
@@ -59,9 +61,7 @@ class Timer {
             const duration = this.lastTick - start;
             if (duration > Timer.#warningThreshold) {
                 alt.logWarning(
-                    `[JS] Timer callback in resource '${cppBindings.resourceName}' (${this.location.fileName}:${
-                        this.location.lineNumber
-                    }) took ${duration}ms to execute (Threshold: ${Timer.#warningThreshold}ms)`
+                    `[JS] Timer callback in resource '${cppBindings.resourceName}' (${formatSourceLocation(this.location)}) took ${duration}ms to execute (Threshold: ${Timer.#warningThreshold}ms)`
                 );
             }
         }
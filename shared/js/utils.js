@@ -31,25 +31,13 @@ export function assert(condition, message) {
 export function assertIsObject(value, message) {
     assert(value !== null && typeof value === "object", message);
 }
+/**
+ * Resolves a location captured with `cppBindings.captureSourceLocation` to `file:line`
+ * @param {number} location
+ */
+export function formatSourceLocation(location) {
+    const { fileName, lineNumber } = cppBindings.resolveSourceLocation(location);
+    return `${fileName}:${lineNumber}`;
+}
 alt.Utils.AssertionError = AssertionError;
 alt.Utils.assert = assert;
-
-export function hash(str) {
-    if (typeof str !== "string") throw new Error("Expected a string as first argument");
-
-    const string = str.toLowerCase();
-    const length = string.length;
-    let hash = 0;
-    for (let i = 0; i < length; i++) {
-        hash += string.charCodeAt(i);
-        hash += hash << 10;
-        hash ^= hash >>> 6;
-    }
-
-    hash += hash << 3;
-    hash ^= hash >>> 11;
-    hash += hash << 15;
-
-    return hash >>> 0; // Convert to unsigned
-}
-cppBindings.registerExport("utils:hash", hash);
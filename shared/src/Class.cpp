@@ -17,6 +17,7 @@ void js::Class::Register(v8::Isolate* isolate)
     initCb(tpl);
     tpl.Get()->SetClassName(js::JSValue(name));
     tpl.Get()->InstanceTemplate()->SetInternalFieldCount(internalFieldCount);
+    if(IScriptObjectHandler::AreScriptObjectsWeak() && IScriptObjectHandler::IsClassBound(this)) ScriptObject::SetupWeakInterceptors(tpl.Get()->InstanceTemplate());
     templateMap.insert({ isolate, tpl });
 }
 
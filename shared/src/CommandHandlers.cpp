@@ -2,6 +2,7 @@
 #include "interfaces/IResource.h"
 #include "Class.h"
 #include "Logger.h"
+#include "helpers/BindingStats.h"
 #include "cpp-sdk/ICore.h"
 
 class HandleVisitor : public v8::PersistentHandleVisitor
@@ -47,8 +48,25 @@ void js::DebugHandlesCommand(const std::vector<std::string>&)
         v8::HandleScope scope(isolate);
         v8::Isolate::Scope isolateScope(isolate);
 
+        js::Logger::Colored << "~g~" << altResource->GetName() << ": ~w~" << resource->GetScriptObjectCount() << " script objects ("
+                            << resource->GetWeakScriptObjectCount() << " weak)" << js::Logger::Endl;
+
         HandleVisitor visitor(resource);
         resource->GetIsolate()->VisitHandlesWithClassIds(&visitor);
         visitor.Dump();
     }
 }
+
+#ifdef DEBUG_ALLOCATIONS
+void js::BindingStatsCommand(const std::vector<std::string>& args)
+{
+    if(args.size() > 0 && args[0] == "reset")
+    {
+        BindingStats::Reset();
+        js::Logger::Colored("~g~Binding stats reset");
+        return;
+    }
+    js::Logger::Colored("~g~Binding allocations:");
+    BindingStats::Dump();
+}
+#endif
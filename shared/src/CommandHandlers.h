@@ -5,4 +5,7 @@
 namespace js
 {
     void DebugHandlesCommand(const std::vector<std::string>&);
+#ifdef DEBUG_ALLOCATIONS
+    void BindingStatsCommand(const std::vector<std::string>& args);
+#endif
 }
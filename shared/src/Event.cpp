@@ -15,17 +15,23 @@ js::Promise js::Event::CallEventBinding(bool custom, int type, EventArgs& args,
     return js::Promise{ result.value_or(v8::Local<v8::Value>()).As<v8::Promise>() };
 }
 
-void js::Event::SendEvent(const alt::CEvent* ev, IResource* resource)
+bool js::Event::WithEventArgs(const alt::CEvent* ev, IResource* resource, const std::function<void(EventArgs&)>& handler)
 {
     Event* eventHandler = GetEventHandler(ev->GetType());
-    if(!eventHandler) return;
+    if(!eventHandler) return false;
 
     EventArgs eventArgs = eventContextClass.Create(resource->GetContext(), (void*)ev);
     eventHandler->argsCb(ev, eventArgs);
-
-    js::Promise promise = CallEventBinding(false, (int)ev->GetType(), eventArgs, resource);
+    handler(eventArgs);
     eventArgs.Get()->SetAlignedPointerInInternalField(1, nullptr);
-    if(!promise.IsValid()) return;
+    return true;
+}
+
+void js::Event::SendEvent(const alt::CEvent* ev, IResource* resource)
+{
+    js::Promise promise{ v8::Local<v8::Promise>() };
+    bool sent = WithEventArgs(ev, resource, [&](EventArgs& eventArgs) { promise = CallEventBinding(false, (int)ev->GetType(), eventArgs, resource); });
+    if(!sent || !promise.IsValid()) return;
     if(ev->GetType() == alt::CEvent::Type::RESOURCE_STOP && static_cast<const alt::CResourceStopEvent*>(ev)->GetResource() == resource->GetResource()) promise.Await();
 }
 
@@ -20,6 +20,7 @@ namespace js
         ENTITY_ENTER_CHECKPOINT,
         ENTITY_LEAVE_CHECKPOINT,
         ERROR,
+        META_BATCH_CHANGE,
 
         SIZE
     };
@@ -54,6 +55,10 @@ namespace js
             GetEventHandlerMap().insert({ type, this });
         }
 
+        // Calls the handler with a newly created arguments object for the event, the event is only accessible from it during the call
+        // Returns false if there is no arguments callback for the event type
+        static bool WithEventArgs(const alt::CEvent* ev, IResource* resource, const std::function<void(EventArgs&)>& handler);
+
         static void SendEvent(const alt::CEvent* ev, IResource* resource);
         static void SendEvent(EventType type, EventArgs& args, IResource* resource);
     };
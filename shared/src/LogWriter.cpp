@@ -0,0 +1,285 @@
+#include "LogWriter.h"
+
+#include <ctime>
+#include <chrono>
+#include <filesystem>
+
+static const char* GetTypeName(js::LogWriter::Type type)
+{
+    switch(type)
+    {
+        case js::LogWriter::Type::INFO:
+        case js::LogWriter::Type::COLORED: return "info";
+        case js::LogWriter::Type::WARN: return "warn";
+        case js::LogWriter::Type::ERR: return "error";
+        default: return "unknown";
+    }
+}
+
+// Formats the timestamp as ISO 8601 in UTC, e.g. 2023-01-01T12:00:00.000Z
+static std::string FormatTimestamp(int64_t timestamp)
+{
+    time_t time = (time_t)(timestamp / 1000);
+    tm utc{};
+#ifdef _WIN32
+    gmtime_s(&utc, &time);
+#else
+    gmtime_r(&time, &utc);
+#endif
+    char buffer[32];
+    size_t length = strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &utc);
+    snprintf(buffer + length, sizeof(buffer) - length, ".%03dZ", (int)(timestamp % 1000));
+    return buffer;
+}
+
+// Appends the string as a JSON string, color codes like ~y~ or ~lr~ are removed
+static void AppendJSONString(std::string& out, const std::string& str)
+{
+    out += '"';
+    for(size_t i = 0; i < str.size(); i++)
+    {
+        char c = str[i];
+        if(c == '~')
+        {
+            size_t end = str.find('~', i + 1);
+            if(end != std::string::npos && end - i <= 3 && end - i >= 2)
+            {
+                bool isColor = true;
+                for(size_t j = i + 1; j < end; j++) isColor = isColor && str[j] >= 'a' && str[j] <= 'z';
+                if(isColor)
+                {
+                    i = end;
+                    continue;
+                }
+            }
+        }
+
+        switch(c)
+        {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+            {
+                if((unsigned char)c < 0x20)
+                {
+                    char buffer[8];
+                    snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned char)c);
+                    out += buffer;
+                }
+                else
+                    out += c;
+            }
+        }
+    }
+    out += '"';
+}
+
+void js::LogWriter::Start(const Options& _options)
+{
+    Stop();
+    if(!_options.async && _options.file.empty()) return;
+    options = _options;
+
+    // The queue size has to be a power of two, so the position can be masked
+    size_t size = 2;
+    while(size < options.queueSize) size <<= 1;
+    slots = std::make_unique<Slot[]>(size);
+    for(size_t i = 0; i < size; i++) slots[i].sequence.store(i, std::memory_order_relaxed);
+    mask = size - 1;
+    enqueuePos = 0;
+    dequeuePos = 0;
+
+    if(!options.file.empty())
+    {
+        std::error_code error;
+        std::filesystem::path path(options.file);
+        if(path.has_parent_path()) std::filesystem::create_directories(path.parent_path(), error);
+        file.open(path, std::ios::out | std::ios::app | std::ios::binary);
+        fileSize = (size_t)std::filesystem::file_size(path, error);
+        if(error) fileSize = 0;
+        if(!file.is_open())
+        {
+            alt::ICore::Instance().LogError("Failed to open log file " + options.file);
+            options.file.clear();
+            if(!options.async) return;
+        }
+    }
+
+    running = true;
+    thread = std::thread(&LogWriter::Run, this);
+}
+
+void js::LogWriter::Stop()
+{
+    if(!running) return;
+    {
+        std::lock_guard lock(mutex);
+        running = false;
+    }
+    wakeup.notify_all();
+    flushed.notify_all();
+    if(thread.joinable()) thread.join();
+
+    if(file.is_open()) file.close();
+    slots.reset();
+}
+
+bool js::LogWriter::Push(Entry&& entry)
+{
+    // Bounded MPMC queue by Dmitry Vyukov, every slot has a sequence number that tells whether it is free or filled
+    size_t pos = enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot;
+    while(true)
+    {
+        slot = &slots[pos & mask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+        if(diff == 0)
+        {
+            if(enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if(diff < 0)
+        {
+            dropped[(size_t)entry.type].fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+            pos = enqueuePos.load(std::memory_order_relaxed);
+    }
+    slot->entry = std::move(entry);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    queued.fetch_add(1, std::memory_order_relaxed);
+
+    if(sleeping.load(std::memory_order_relaxed)) wakeup.notify_one();
+    return true;
+}
+
+bool js::LogWriter::Pop(Entry& entry)
+{
+    // Only the writer thread pops, so the position doesn't have to be claimed
+    size_t pos = dequeuePos.load(std::memory_order_relaxed);
+    Slot& slot = slots[pos & mask];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if((intptr_t)sequence - (intptr_t)(pos + 1) < 0) return false;
+
+    entry = std::move(slot.entry);
+    dequeuePos.store(pos + 1, std::memory_order_relaxed);
+    slot.sequence.store(pos + mask + 1, std::memory_order_release);
+    return true;
+}
+
+void js::LogWriter::Flush()
+{
+    if(!running || std::this_thread::get_id() == thread.get_id()) return;
+
+    uint64_t target = queued.load();
+    wakeup.notify_one();
+    std::unique_lock lock(mutex);
+    flushed.wait(lock, [&]() { return written.load() >= target || !running; });
+}
+
+js::LogWriter::Stats js::LogWriter::GetStats() const
+{
+    Stats stats;
+    stats.queued = queued.load(std::memory_order_relaxed);
+    stats.written = written.load(std::memory_order_relaxed);
+    for(size_t i = 0; i < dropped.size(); i++) stats.dropped[i] = dropped[i].load(std::memory_order_relaxed);
+    return stats;
+}
+
+void js::LogWriter::Run()
+{
+    Entry entry;
+    while(true)
+    {
+        // Check before draining, so entries pushed before stopping are still written
+        bool stopping = !running;
+
+        bool anyWritten = false;
+        while(Pop(entry))
+        {
+            Write(entry);
+            written.fetch_add(1);
+            anyWritten = true;
+        }
+        if(anyWritten)
+        {
+            if(file.is_open()) file.flush();
+            std::lock_guard lock(mutex);
+            flushed.notify_all();
+        }
+        if(stopping) break;
+
+        std::unique_lock lock(mutex);
+        sleeping = true;
+        wakeup.wait_for(lock,
+                        std::chrono::milliseconds(100),
+                        [&]()
+                        {
+                            size_t pos = dequeuePos.load(std::memory_order_relaxed);
+                            return !running || slots[pos & mask].sequence.load(std::memory_order_acquire) == pos + 1;
+                        });
+        sleeping = false;
+    }
+}
+
+void js::LogWriter::Write(const Entry& entry)
+{
+    if(entry.console)
+    {
+        switch(entry.type)
+        {
+            case Type::INFO: alt::ICore::Instance().LogInfo(entry.message, entry.resource); break;
+            case Type::COLORED: alt::ICore::Instance().LogColored(entry.message, entry.resource); break;
+            case Type::WARN: alt::ICore::Instance().LogWarning(entry.message, entry.resource); break;
+            case Type::ERR: alt::ICore::Instance().LogError(entry.message, entry.resource); break;
+            default: break;
+        }
+    }
+    if(file.is_open()) WriteFile(entry);
+}
+
+void js::LogWriter::WriteFile(const Entry& entry)
+{
+    std::string line;
+    line.reserve(entry.message.size() + 128);
+    line += "{\"timestamp\":\"";
+    line += FormatTimestamp(entry.timestamp);
+    line += "\",\"level\":\"";
+    line += GetTypeName(entry.type);
+    line += "\",\"resource\":";
+    if(entry.resourceName.empty()) line += "null";
+    else
+        AppendJSONString(line, entry.resourceName);
+    line += ",\"message\":";
+    AppendJSONString(line, entry.message);
+    if(!entry.file.empty())
+    {
+        line += ",\"file\":";
+        AppendJSONString(line, entry.file);
+        line += ",\"line\":" + std::to_string(entry.line);
+        line += ",\"column\":" + std::to_string(entry.column);
+    }
+    line += "}\n";
+
+    file.write(line.data(), line.size());
+    fileSize += line.size();
+    if(fileSize >= options.maxFileSize) RotateFile();
+}
+
+void js::LogWriter::RotateFile()
+{
+    // log.jsonl -> log.jsonl.1 -> log.jsonl.2 ..., the oldest file is removed
+    file.close();
+    std::error_code error;
+    std::string path = options.file;
+    std::filesystem::remove(path + "." + std::to_string(options.maxFiles), error);
+    for(size_t i = options.maxFiles; i > 1; i--) std::filesystem::rename(path + "." + std::to_string(i - 1), path + "." + std::to_string(i), error);
+    if(options.maxFiles > 0) std::filesystem::rename(path, path + ".1", error);
+
+    file.open(path, std::ios::out | std::ios::trunc | std::ios::binary);
+    fileSize = 0;
+}
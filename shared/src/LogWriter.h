@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <fstream>
+#include <mutex>
+#include <condition_variable>
+
+#include "cpp-sdk/ICore.h"
+
+namespace js
+{
+    // Writes log entries on a background thread, so logging never blocks the main thread on the console or a file
+    // Entries are passed via a bounded lock-free queue, if the queue is full the entry is dropped and counted
+    // Optionally every entry is also written as a JSON line (resource, level, timestamp, source location) to a rotating file
+    class LogWriter
+    {
+    public:
+        enum class Type : uint8_t
+        {
+            INFO,
+            COLORED,
+            WARN,
+            ERR,
+
+            SIZE
+        };
+
+        struct Entry
+        {
+            Type type = Type::INFO;
+            std::string message;
+            // Only used for the console output, resources flush the writer before they are destroyed
+            alt::IResource* resource = nullptr;
+            std::string resourceName;
+            int64_t timestamp = 0;  // Milliseconds since epoch
+            std::string file;
+            int line = 0;
+            int column = 0;
+            // Whether the entry still has to be written to the console, false if it was already logged synchronously
+            bool console = true;
+        };
+
+        struct Options
+        {
+            bool async = false;
+            size_t queueSize = 4096;
+            std::string file;
+            size_t maxFileSize = 10 * 1024 * 1024;
+            size_t maxFiles = 5;
+        };
+
+        struct Stats
+        {
+            uint64_t queued = 0;
+            uint64_t written = 0;
+            std::array<uint64_t, (size_t)Type::SIZE> dropped{};
+        };
+
+    private:
+        struct Slot
+        {
+            std::atomic<size_t> sequence;
+            Entry entry;
+        };
+
+        Options options;
+        std::unique_ptr<Slot[]> slots;
+        size_t mask = 0;
+        alignas(64) std::atomic<size_t> enqueuePos = 0;
+        alignas(64) std::atomic<size_t> dequeuePos = 0;
+
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable wakeup;
+        std::condition_variable flushed;
+        std::atomic<bool> running = false;
+        std::atomic<bool> sleeping = false;
+
+        std::atomic<uint64_t> queued = 0;
+        std::atomic<uint64_t> written = 0;
+        std::array<std::atomic<uint64_t>, (size_t)Type::SIZE> dropped{};
+
+        std::ofstream file;
+        size_t fileSize = 0;
+
+        bool Pop(Entry& entry);
+        void Run();
+        void Write(const Entry& entry);
+        void WriteFile(const Entry& entry);
+        void RotateFile();
+
+    public:
+        static LogWriter& Instance()
+        {
+            static LogWriter instance;
+            return instance;
+        }
+
+        ~LogWriter()
+        {
+            Stop();
+        }
+
+        // Starts the background thread if async logging or the log file is enabled
+        void Start(const Options& options);
+        // Writes all remaining entries and stops the background thread
+        void Stop();
+
+        bool IsAsync() const
+        {
+            return running && options.async;
+        }
+        bool HasFile() const
+        {
+            return running && !options.file.empty();
+        }
+
+        // Returns false if the queue is full and the entry was dropped
+        bool Push(Entry&& entry);
+        // Blocks until all entries queued before the call have been written
+        void Flush();
+
+        Stats GetStats() const;
+    };
+}  // namespace js
@@ -1,9 +1,16 @@
 #include "Logger.h"
 #include "interfaces/IResource.h"
 
+#include <chrono>
+
 js::Logger& js::Logger::operator<<(const js::Logger::EndlStruct&)
 {
+    LogWriter& writer = LogWriter::Instance();
+    bool isAsync = writer.IsAsync();
+    bool hasFile = writer.HasFile();
+
     alt::IResource* altResource = nullptr;
+    LogWriter::Entry entry;
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
     if(isolate != nullptr)
     {
@@ -13,17 +20,44 @@ js::Logger& js::Logger::operator<<(const js::Logger::EndlStruct&)
         {
             js::IResource* resource = js::IResource::GetFromContext(context);
             if(resource) altResource = resource->GetResource();
+
+            // Only the top frame is needed for the structured output
+            if(hasFile)
+            {
+                v8::Local<v8::StackTrace> stackTrace = v8::StackTrace::CurrentStackTrace(isolate, 1);
+                if(stackTrace->GetFrameCount() > 0)
+                {
+                    v8::Local<v8::StackFrame> frame = stackTrace->GetFrame(isolate, 0);
+                    v8::Local<v8::String> scriptName = frame->GetScriptName();
+                    if(!scriptName.IsEmpty()) entry.file = js::CppValue(scriptName);
+                    entry.line = frame->GetLineNumber();
+                    entry.column = frame->GetColumn();
+                }
+            }
         }
     }
 
     std::string str = stream.str();
-    switch(type)
+    stream.str("");
+    if(!isAsync)
     {
-        case Type::INFO: alt::ICore::Instance().LogInfo(str, altResource); break;
-        case Type::COLORED: alt::ICore::Instance().LogColored(str, altResource); break;
-        case Type::WARN: alt::ICore::Instance().LogWarning(str, altResource); break;
-        case Type::ERR: alt::ICore::Instance().LogError(str, altResource); break;
+        switch(type)
+        {
+            case Type::INFO: alt::ICore::Instance().LogInfo(str, altResource); break;
+            case Type::COLORED: alt::ICore::Instance().LogColored(str, altResource); break;
+            case Type::WARN: alt::ICore::Instance().LogWarning(str, altResource); break;
+            case Type::ERR: alt::ICore::Instance().LogError(str, altResource); break;
+            default: break;
+        }
+        if(!hasFile) return *this;
     }
-    stream.str("");
+
+    entry.type = type;
+    entry.message = std::move(str);
+    entry.resource = altResource;
+    if(altResource) entry.resourceName = altResource->GetName();
+    entry.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    entry.console = isAsync;
+    writer.Push(std::move(entry));
     return *this;
 }
@@ -3,19 +3,14 @@
 #include <sstream>
 
 #include "cpp-sdk/ICore.h"
+#include "LogWriter.h"
 
 namespace js
 {
     class Logger
     {
     private:
-        enum class Type
-        {
-            INFO,
-            COLORED,
-            WARN,
-            ERR,
-        };
+        using Type = LogWriter::Type;
 
         std::stringstream stream;
         Type type;
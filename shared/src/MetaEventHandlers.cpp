@@ -0,0 +1,37 @@
+#include "MetaEventHandlers.h"
+#include "Event.h"
+#include "interfaces/IResource.h"
+
+void js::MetaEventHandlers::Dispatch(const alt::CEvent* ev, IResource* resource)
+{
+    // Most events have no keyed handlers, so check the type before looking at the key
+    auto eventIt = events.find(ev->GetType());
+    if(eventIt == events.end()) return;
+
+    // The key is looked up straight from the event, so it is never copied
+    KeyMap& keys = eventIt->second;
+    KeyMap::iterator keyIt;
+    switch(ev->GetType())
+    {
+        case alt::CEvent::Type::LOCAL_SYNCED_META_CHANGE: keyIt = keys.find(static_cast<const alt::CLocalMetaDataChangeEvent*>(ev)->GetKey()); break;
+        case alt::CEvent::Type::SYNCED_META_CHANGE: keyIt = keys.find(static_cast<const alt::CSyncedMetaDataChangeEvent*>(ev)->GetKey()); break;
+        case alt::CEvent::Type::STREAM_SYNCED_META_CHANGE: keyIt = keys.find(static_cast<const alt::CStreamSyncedMetaDataChangeEvent*>(ev)->GetKey()); break;
+        case alt::CEvent::Type::GLOBAL_META_CHANGE:
+        case alt::CEvent::Type::GLOBAL_SYNCED_META_CHANGE: keyIt = keys.find(static_cast<const alt::CGlobalMetaDataChangeEvent*>(ev)->GetKey()); break;
+        default: return;
+    }
+    if(keyIt == keys.end()) return;
+
+    // Copy the handlers, so they can subscribe or unsubscribe while being called
+    v8::Isolate* isolate = resource->GetIsolate();
+    std::vector<v8::Local<v8::Function>> handlers;
+    handlers.reserve(keyIt->second.size());
+    for(auto& handler : keyIt->second) handlers.push_back(handler.Get(isolate));
+
+    Event::WithEventArgs(ev,
+                         resource,
+                         [&](Event::EventArgs& args)
+                         {
+                             for(v8::Local<v8::Function> handler : handlers) js::Function(handler).Call(args.Get());
+                         });
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+
+#include "v8.h"
+#include "cpp-sdk/SDK.h"
+#include "helpers/JS.h"
+
+namespace js
+{
+    class IResource;
+
+    // Meta change handlers subscribed to specific keys, e.g. via `alt.Events.onSyncedMetaChange("key", handler)`
+    // The key is checked natively, so changes of other keys never have their values converted
+    class MetaEventHandlers
+    {
+        struct Hash
+        {
+            using is_transparent = void;
+
+            size_t operator()(std::string_view str) const
+            {
+                return std::hash<std::string_view>{}(str);
+            }
+        };
+        using KeyMap = std::unordered_map<std::string, std::vector<Persistent<v8::Function>>, Hash, std::equal_to<>>;
+
+        std::unordered_map<alt::CEvent::Type, KeyMap> events;
+
+    public:
+        static bool IsMetaEvent(alt::CEvent::Type type)
+        {
+            switch(type)
+            {
+                case alt::CEvent::Type::LOCAL_SYNCED_META_CHANGE:
+                case alt::CEvent::Type::SYNCED_META_CHANGE:
+                case alt::CEvent::Type::STREAM_SYNCED_META_CHANGE:
+                case alt::CEvent::Type::GLOBAL_META_CHANGE:
+                case alt::CEvent::Type::GLOBAL_SYNCED_META_CHANGE: return true;
+                default: return false;
+            }
+        }
+
+        void Add(alt::CEvent::Type type, const std::string& key, v8::Local<v8::Function> handler)
+        {
+            events[type][key].push_back(Persistent<v8::Function>(v8::Isolate::GetCurrent(), handler));
+        }
+        bool Remove(alt::CEvent::Type type, const std::string& key, v8::Local<v8::Function> handler)
+        {
+            auto eventIt = events.find(type);
+            if(eventIt == events.end()) return false;
+            auto keyIt = eventIt->second.find(key);
+            if(keyIt == eventIt->second.end()) return false;
+
+            std::vector<Persistent<v8::Function>>& handlers = keyIt->second;
+            auto it = std::find(handlers.begin(), handlers.end(), handler);
+            if(it == handlers.end()) return false;
+            handlers.erase(it);
+
+            if(handlers.empty()) eventIt->second.erase(keyIt);
+            if(eventIt->second.empty()) events.erase(eventIt);
+            return true;
+        }
+        void Clear()
+        {
+            events.clear();
+        }
+
+        bool Has(alt::CEvent::Type type) const
+        {
+            return events.contains(type);
+        }
+
+        // Calls the handlers subscribed to the changed key, has to be called while a context is entered
+        void Dispatch(const alt::CEvent* ev, IResource* resource);
+    };
+}  // namespace js
@@ -42,6 +42,66 @@ js::ScriptObject* js::ScriptObject::Get(v8::Local<v8::Object> obj)
 
 void js::ScriptObject::Destroy(ScriptObject* scriptObject)
 {
-    scriptObject->Get()->SetAlignedPointerInInternalField(0, nullptr);
+    if(!scriptObject->collected)
+    {
+        scriptObject->Get()->SetAlignedPointerInInternalField(0, nullptr);
+        scriptObject->jsObject.Reset();
+    }
     delete scriptObject;
 }
+
+void js::ScriptObject::WeakCallback(const v8::WeakCallbackInfo<ScriptObject>& info)
+{
+    // This is called while the GC is running, so the script object is only marked here
+    // and removed by the handler the next time it is safe to do so
+    ScriptObject* scriptObject = info.GetParameter();
+    scriptObject->jsObject.Reset();
+    scriptObject->collected = true;
+    scriptObject->handler->OnScriptObjectCollected(scriptObject);
+}
+
+void js::ScriptObject::MakeWeak()
+{
+    if(weak || collected) return;
+    jsObject.SetWeak(this, WeakCallback, v8::WeakCallbackType::kParameter);
+    weak = true;
+}
+
+void js::ScriptObject::MakeStrong()
+{
+    if(!weak || collected) return;
+    jsObject.ClearWeak();
+    weak = false;
+}
+
+void js::ScriptObject::OnPropertySet(const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    // The return value is not set, so the property is still set like without the interceptor
+    ScriptObject* scriptObject = Get(info.Holder());
+    if(scriptObject) scriptObject->MakeStrong();
+}
+
+static void NamedSetterInterceptor(v8::Local<v8::Name>, v8::Local<v8::Value>, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    js::ScriptObject::OnPropertySet(info);
+}
+static void NamedDefinerInterceptor(v8::Local<v8::Name>, const v8::PropertyDescriptor&, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    js::ScriptObject::OnPropertySet(info);
+}
+static void IndexedSetterInterceptor(uint32_t, v8::Local<v8::Value>, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    js::ScriptObject::OnPropertySet(info);
+}
+static void IndexedDefinerInterceptor(uint32_t, const v8::PropertyDescriptor&, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    js::ScriptObject::OnPropertySet(info);
+}
+
+void js::ScriptObject::SetupWeakInterceptors(v8::Local<v8::ObjectTemplate> tpl)
+{
+    // Setting an accessor from the prototype (e.g. player.pos) also makes the object strong,
+    // the next sweep makes it weak again if no own property was added
+    tpl->SetHandler(v8::NamedPropertyHandlerConfiguration(nullptr, NamedSetterInterceptor, nullptr, nullptr, nullptr, NamedDefinerInterceptor, nullptr));
+    tpl->SetHandler(v8::IndexedPropertyHandlerConfiguration(nullptr, IndexedSetterInterceptor, nullptr, nullptr, nullptr, IndexedDefinerInterceptor, nullptr));
+}
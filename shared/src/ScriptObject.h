@@ -20,6 +20,9 @@ namespace js
         Persistent<v8::Object> jsObject;
         alt::IBaseObject* object = nullptr;
         Class* class_ = nullptr;
+        IScriptObjectHandler* handler = nullptr;
+        bool weak = false;
+        bool collected = false;  // Set when the weak JS object was garbage collected, the script object is deleted afterwards
 
         ScriptObject(v8::Isolate* _isolate, v8::Local<v8::Object> _jsObject, alt::IBaseObject* _object, Class* _class);
         static ScriptObject* Create(v8::Local<v8::Context> context, alt::IBaseObject* object, Class* class_);
@@ -28,6 +31,8 @@ namespace js
         static ScriptObject* Get(v8::Local<v8::Object> obj);
         static void Destroy(ScriptObject* scriptObject);
 
+        static void WeakCallback(const v8::WeakCallbackInfo<ScriptObject>& info);
+
     public:
         v8::Local<v8::Object> Get() const
         {
@@ -48,5 +53,23 @@ namespace js
         {
             return class_;
         }
+
+        bool IsWeak() const
+        {
+            return weak;
+        }
+        bool IsCollected() const
+        {
+            return collected;
+        }
+
+        // Allows the JS object to be garbage collected when it is not referenced anymore,
+        // the object is then recreated the next time it is needed
+        void MakeWeak();
+        void MakeStrong();
+
+        // Makes weak objects strong before the script sets or defines a property on them, so the property can't get lost
+        static void SetupWeakInterceptors(v8::Local<v8::ObjectTemplate> tpl);
+        static void OnPropertySet(const v8::PropertyCallbackInfo<v8::Value>& info);
     };
 }  // namespace js
@@ -1,5 +1,6 @@
 #include "Class.h"
 #include "cpp-sdk/ICore.h"
+#include "helpers/MetaBatch.h"
 
 static void ValidGetter(js::PropertyContext& ctx)
 {
@@ -51,6 +52,13 @@ static void MetaEnumerator(js::DynamicPropertyEnumeratorContext& ctx)
     ctx.Return(keys);
 }
 
+static void SetMetaBatch(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckThis()) return;
+    alt::IBaseObject* obj = ctx.GetThisObject<alt::IBaseObject>();
+    js::SetMetaBatch(ctx, "meta", obj, [&](const std::string& key, alt::MValue value) { obj->SetMetaData(key, value); });
+}
+
 static void GetByID(js::FunctionContext& ctx)
 {
     if(!ctx.CheckArgCount(2)) return;
@@ -74,6 +82,7 @@ extern js::Class baseObjectClass("BaseObject", nullptr, [](js::ClassTemplate& tp
     tpl.Method("destroy", Destroy);
 
     tpl.DynamicProperty("meta", MetaGetter, MetaSetter, MetaDeleter, MetaEnumerator);
+    tpl.Method("setMetaBatch", SetMetaBatch);
 
     tpl.StaticFunction("getByID", GetByID);
 });
@@ -1,11 +1,12 @@
 #include "Class.h"
 #include "cpp-sdk/ICore.h"
+#include "interfaces/IResource.h"
 
 static void SyncedMetaGetter(js::DynamicPropertyGetterContext& ctx)
 {
     if(!ctx.CheckParent()) return;
     alt::IEntity* obj = ctx.GetParent<alt::IEntity>();
-    ctx.Return(obj->GetSyncedMetaData(ctx.GetProperty()));
+    js::ReturnMeta(ctx, ctx.GetResource()->GetMetaCache(), obj, js::MetaCache::Type::SYNCED_META, [&]() { return obj->GetSyncedMetaData(ctx.GetProperty()); });
 }
 
 static void SyncedMetaEnumerator(js::DynamicPropertyEnumeratorContext& ctx)
@@ -20,7 +21,7 @@ static void StreamSyncedMetaGetter(js::DynamicPropertyGetterContext& ctx)
 {
     if(!ctx.CheckParent()) return;
     alt::IEntity* obj = ctx.GetParent<alt::IEntity>();
-    ctx.Return(obj->GetStreamSyncedMetaData(ctx.GetProperty()));
+    js::ReturnMeta(ctx, ctx.GetResource()->GetMetaCache(), obj, js::MetaCache::Type::STREAM_SYNCED_META, [&]() { return obj->GetStreamSyncedMetaData(ctx.GetProperty()); });
 }
 
 static void StreamSyncedMetaEnumerator(js::DynamicPropertyEnumeratorContext& ctx)
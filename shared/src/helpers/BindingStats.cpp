@@ -0,0 +1,124 @@
+#ifdef DEBUG_ALLOCATIONS
+
+#include "BindingStats.h"
+#include "Logger.h"
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <algorithm>
+#include <sstream>
+
+static thread_local uint64_t allocationCount = 0;
+
+static void* Allocate(size_t size)
+{
+    allocationCount++;
+    if(size == 0) size = 1;
+    return std::malloc(size);
+}
+
+void* operator new(size_t size)
+{
+    void* ptr = Allocate(size);
+    if(!ptr) throw std::bad_alloc();
+    return ptr;
+}
+void* operator new[](size_t size)
+{
+    void* ptr = Allocate(size);
+    if(!ptr) throw std::bad_alloc();
+    return ptr;
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+void operator delete[](void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+uint64_t js::BindingStats::GetAllocationCount()
+{
+    return allocationCount;
+}
+
+void js::BindingStats::Record(const void* binding, uint64_t allocations, bool errored)
+{
+    Entry& entry = GetEntries()[binding];
+    entry.calls++;
+    if(errored)
+    {
+        entry.erroredCalls++;
+        entry.erroredAllocations += allocations;
+    }
+    else
+        entry.allocations += allocations;
+}
+
+void js::BindingStats::RegisterName(const void* binding, const std::string& name)
+{
+    Entry& entry = GetEntries()[binding];
+    if(entry.name.empty()) entry.name = name;
+}
+
+void js::BindingStats::Reset()
+{
+    for(auto& [binding, entry] : GetEntries())
+    {
+        entry.calls = 0;
+        entry.allocations = 0;
+        entry.erroredCalls = 0;
+        entry.erroredAllocations = 0;
+    }
+}
+
+void js::BindingStats::Dump()
+{
+    std::vector<std::pair<const void*, Entry*>> called;
+    for(auto& [binding, entry] : GetEntries())
+    {
+        if(entry.calls != 0) called.push_back({ binding, &entry });
+    }
+    if(called.empty())
+    {
+        Logger::Colored("~y~No bindings called");
+        return;
+    }
+    std::sort(called.begin(), called.end(), [](auto& a, auto& b) { return a.second->calls > b.second->calls; });
+
+    for(auto& [binding, entry] : called)
+    {
+        std::string name = entry->name;
+        if(name.empty())
+        {
+            std::stringstream address;
+            address << "<unnamed " << binding << ">";
+            name = address.str();
+        }
+        uint64_t successfulCalls = entry->calls - entry->erroredCalls;
+        double perCall = successfulCalls == 0 ? 0 : (double)entry->allocations / successfulCalls;
+        Logger::Colored << "~y~" << name << ": ~w~" << entry->calls << " calls, " << perCall << " allocations per call";
+        if(entry->erroredCalls != 0) Logger::Colored << " (" << entry->erroredCalls << " errored, " << entry->erroredAllocations << " allocations)";
+        Logger::Colored << Logger::Endl;
+    }
+}
+
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#ifdef DEBUG_ALLOCATIONS
+
+#include <string>
+#include <unordered_map>
+
+namespace js
+{
+    // Counts the heap allocations done while a binding is being called
+    // Only available when built with the 'debug-allocations' option, as it replaces the global allocator
+    class BindingStats
+    {
+    public:
+        struct Entry
+        {
+            std::string name;
+            uint64_t calls = 0;
+            uint64_t allocations = 0;
+            uint64_t erroredCalls = 0;
+            uint64_t erroredAllocations = 0;
+        };
+
+        // Measures the allocations from construction until destruction
+        // Nested binding calls are included in the allocations of the outer binding
+        class Scope
+        {
+            const void* binding;
+            uint64_t start;
+            bool errored = false;
+
+        public:
+            Scope(const void* _binding) : binding(_binding), start(GetAllocationCount()) {}
+            ~Scope()
+            {
+                uint64_t allocations = GetAllocationCount() - start;
+                Record(binding, allocations, errored);
+            }
+
+            void SetErrored(bool _errored)
+            {
+                errored = _errored;
+            }
+        };
+
+    private:
+        static std::unordered_map<const void*, Entry>& GetEntries()
+        {
+            static std::unordered_map<const void*, Entry> entries;
+            return entries;
+        }
+
+        static void Record(const void* binding, uint64_t allocations, bool errored);
+
+    public:
+        // Number of allocations done on the current thread
+        static uint64_t GetAllocationCount();
+
+        static void RegisterName(const void* binding, const std::string& name);
+        static void Reset();
+        static void Dump();
+    };
+}  // namespace js
+
+#endif
@@ -6,11 +6,14 @@
 #include "Convert.h"
 #include "Type.h"
 
+#include <array>
+
 namespace js
 {
     class IResource;
 
     static void Throw(const std::string& message);
+    static void Throw(const char* message);
 
     template<class CallbackInfo>
     class CallContext
@@ -74,15 +77,25 @@ namespace js
             error = message;
             errored = true;
         }
+        void Throw(const char* message)
+        {
+            if(!noThrow) js::Throw(message);
+            error = message;
+            errored = true;
+        }
 
+        // The message is only copied if the check fails, so prefer passing string literals
+        bool Check(bool condition, const char* message)
+        {
+            if(condition) return true;
+            Throw(message);
+            return false;
+        }
         bool Check(bool condition, const std::string& message)
         {
-            if(!condition)
-            {
-                Throw(message);
-                return false;
-            }
-            return true;
+            if(condition) return true;
+            Throw(message);
+            return false;
         }
 
         bool CheckThis()
@@ -142,40 +155,41 @@ namespace js
 
     class FunctionContext : public CallContext<v8::FunctionCallbackInfo<v8::Value>>
     {
-        std::vector<Type> argTypes;  // Cache argument types
+        // Cache argument types inline, so creating the context doesn't allocate
+        // Arguments past the cache size are not cached
+        static constexpr int argTypeCacheSize = 8;
+        std::array<Type, argTypeCacheSize> argTypes{};
 
     public:
-        FunctionContext(const v8::FunctionCallbackInfo<v8::Value>& _info) : CallContext(_info)
-        {
-            argTypes.resize(info.Length());
-        }
+        FunctionContext(const v8::FunctionCallbackInfo<v8::Value>& _info) : CallContext(_info) {}
 
+        // Error messages are only built if the check fails
         bool CheckArgCount(int count)
         {
-            return Check(info.Length() == count, "Invalid number of arguments, expected " + std::to_string(count) + " arguments");
+            if(info.Length() == count) return true;
+            Throw("Invalid number of arguments, expected " + std::to_string(count) + " arguments");
+            return false;
         }
         bool CheckArgCount(int min, int max)
         {
-            return Check(info.Length() >= min && info.Length() <= max,
-                         "Invalid number of arguments, expected minimum " + std::to_string(min) + " and maximum " + std::to_string(max) + " arguments");
+            if(info.Length() >= min && info.Length() <= max) return true;
+            Throw("Invalid number of arguments, expected minimum " + std::to_string(min) + " and maximum " + std::to_string(max) + " arguments");
+            return false;
         }
         bool CheckArgType(int index, Type type)
         {
-            return Check(GetArgType(index) == type,
-                         "Invalid argument type at index " + std::to_string(index) + ", expected " + TypeToString(type) + " but got " + TypeToString(GetArgType(index)));
+            if(GetArgType(index) == type) return true;
+            Throw("Invalid argument type at index " + std::to_string(index) + ", expected " + TypeToString(type) + " but got " + TypeToString(GetArgType(index)));
+            return false;
         }
         bool CheckArgType(int index, std::initializer_list<Type> types)
         {
-            bool result = false;
             for(Type type : types)
             {
-                if(GetArgType(index) == type)
-                {
-                    result = true;
-                    break;
-                }
+                if(GetArgType(index) == type) return true;
             }
-            return Check(result, "Invalid argument type at index " + std::to_string(index) + ", expected one of " + TypeToString(types) + " but got " + TypeToString(GetArgType(index)));
+            Throw("Invalid argument type at index " + std::to_string(index) + ", expected one of " + TypeToString(types) + " but got " + TypeToString(GetArgType(index)));
+            return false;
         }
         bool CheckCtor()
         {
@@ -184,6 +198,7 @@ namespace js
 
         Type GetArgType(int index)
         {
+            if(index >= argTypeCacheSize) return GetType(info[index], GetResource());
             if(argTypes[index] != Type::INVALID) return argTypes[index];
             Type argType = GetType(info[index], GetResource());
             argTypes[index] = argType;
@@ -235,8 +250,7 @@ namespace js
             Type argType = GetArgType(index);
             if(argType == Type::STRING)
             {
-                std::string str = CppValue(info[index].As<v8::String>());
-                outValue = alt::ICore::Instance().Hash(str.c_str());
+                outValue = HashString(GetIsolate(), info[index].As<v8::String>());
                 return true;
             }
             else if(argType == Type::NUMBER)
@@ -268,7 +282,9 @@ namespace js
 
         bool CheckValueType(Type type)
         {
-            return this->Check(GetValueType() == type, "Invalid value, expected " + TypeToString(type) + " but got " + TypeToString(GetValueType()));
+            if(GetValueType() == type) return true;
+            this->Throw("Invalid value, expected " + TypeToString(type) + " but got " + TypeToString(GetValueType()));
+            return false;
         }
 
         template<class T>
@@ -280,7 +296,7 @@ namespace js
             std::optional<T> result = CppValue<T>(value);
             if(!result.has_value())
             {
-                Throw("Invalid value type, expected " + TypeToString(CppTypeToJSType<T>()) + " but got " + TypeToString(GetValueType()));
+                this->Throw("Invalid value type, expected " + TypeToString(CppTypeToJSType<T>()) + " but got " + TypeToString(GetValueType()));
                 return false;
             }
             outValue = (T)result.value();
@@ -292,8 +308,7 @@ namespace js
             Type argType = GetValueType();
             if(argType == Type::STRING)
             {
-                std::string str = CppValue(value.As<v8::String>());
-                outValue = alt::ICore::Instance().Hash(str.c_str());
+                outValue = HashString(this->GetIsolate(), value.As<v8::String>());
                 return true;
             }
             else if(argType == Type::NUMBER)
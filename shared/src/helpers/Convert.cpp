@@ -2,6 +2,8 @@
 #include "interfaces/IResource.h"
 #include "JS.h"
 
+#include <cctype>
+
 v8::Local<v8::Value> js::JSValue(alt::IBaseObject* object)
 {
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
@@ -355,3 +357,25 @@ js::IResource* js::GetCurrentResource(v8::Isolate* isolate)
     v8::Isolate* currentIsolate = isolate == nullptr ? v8::Isolate::GetCurrent() : isolate;
     return IResource::GetFromContext(currentIsolate->GetEnteredOrMicrotaskContext());
 }
+
+uint32_t js::HashString(v8::Isolate* isolate, v8::Local<v8::String> str)
+{
+    constexpr int bufferSize = 256;
+    char buffer[bufferSize];
+    int length = str->Length();
+
+    // Most strings are ASCII one byte strings, their characters can be copied directly instead of being encoded as UTF-8
+    if(str->IsOneByte() && length <= bufferSize)
+    {
+        str->WriteOneByte(isolate, (uint8_t*)buffer, 0, length, v8::String::NO_NULL_TERMINATION);
+        bool isAscii = true;
+        for(int i = 0; i < length && isAscii; i++) isAscii = (uint8_t)buffer[i] < 0x80;
+        if(isAscii) return HashString(std::string_view(buffer, length));
+    }
+
+    // Joaat over the lowercased UTF-8 bytes, like alt::ICore::Hash
+    int utf8Length = str->Utf8Length(isolate);
+    if(utf8Length > bufferSize) return HashString(CppValue(str));
+    str->WriteUtf8(isolate, buffer, bufferSize, nullptr, v8::String::NO_NULL_TERMINATION);
+    return HashString(std::string_view(buffer, utf8Length));
+}
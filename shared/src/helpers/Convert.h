@@ -2,11 +2,14 @@
 
 #include <optional>
 #include <vector>
+#include <string_view>
 #include <unordered_map>
 
 #include "v8.h"
 #include "cpp-sdk/SDK.h"
 
+#include "StringTable.h"
+
 namespace js
 {
     class Array;
@@ -166,9 +169,9 @@ namespace js
         v8::Local<v8::Value> yVal;
         v8::Local<v8::Value> zVal;
 
-        if(!obj->Get(ctx, js::JSValue("x")).ToLocal(&xVal)) return std::nullopt;
-        if(!obj->Get(ctx, js::JSValue("y")).ToLocal(&yVal)) return std::nullopt;
-        if(!obj->Get(ctx, js::JSValue("z")).ToLocal(&zVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("x")).ToLocal(&xVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("y")).ToLocal(&yVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("z")).ToLocal(&zVal)) return std::nullopt;
 
         if(!xVal->IsNumber() || !yVal->IsNumber() || !zVal->IsNumber()) return std::nullopt;
 
@@ -185,8 +188,8 @@ namespace js
         v8::Local<v8::Value> xVal;
         v8::Local<v8::Value> yVal;
 
-        if(!obj->Get(ctx, js::JSValue("x")).ToLocal(&xVal)) return std::nullopt;
-        if(!obj->Get(ctx, js::JSValue("y")).ToLocal(&yVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("x")).ToLocal(&xVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("y")).ToLocal(&yVal)) return std::nullopt;
 
         if(!xVal->IsNumber() || !yVal->IsNumber()) return std::nullopt;
 
@@ -205,10 +208,10 @@ namespace js
         v8::Local<v8::Value> bVal;
         v8::Local<v8::Value> aVal;
 
-        if(!obj->Get(ctx, js::JSValue("r")).ToLocal(&rVal)) return std::nullopt;
-        if(!obj->Get(ctx, js::JSValue("g")).ToLocal(&gVal)) return std::nullopt;
-        if(!obj->Get(ctx, js::JSValue("b")).ToLocal(&bVal)) return std::nullopt;
-        if(!obj->Get(ctx, js::JSValue("a")).ToLocal(&aVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("r")).ToLocal(&rVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("g")).ToLocal(&gVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("b")).ToLocal(&bVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("a")).ToLocal(&aVal)) return std::nullopt;
 
         if(!rVal->IsNumber() || !gVal->IsNumber() || !bVal->IsNumber() || !aVal->IsNumber()) return std::nullopt;
 
@@ -227,10 +230,10 @@ namespace js
         v8::Local<v8::Value> zVal;
         v8::Local<v8::Value> wVal;
 
-        if(!obj->Get(ctx, js::JSValue("x")).ToLocal(&xVal)) return std::nullopt;
-        if(!obj->Get(ctx, js::JSValue("y")).ToLocal(&yVal)) return std::nullopt;
-        if(!obj->Get(ctx, js::JSValue("z")).ToLocal(&zVal)) return std::nullopt;
-        if(!obj->Get(ctx, js::JSValue("w")).ToLocal(&wVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("x")).ToLocal(&xVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("y")).ToLocal(&yVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("z")).ToLocal(&zVal)) return std::nullopt;
+        if(!obj->Get(ctx, js::JSKey("w")).ToLocal(&wVal)) return std::nullopt;
 
         if(!xVal->IsNumber() || !yVal->IsNumber() || !zVal->IsNumber() || !wVal->IsNumber()) return std::nullopt;
 
@@ -366,4 +369,22 @@ namespace js
     }
 
     IResource* GetCurrentResource(v8::Isolate* isolate = nullptr);
+
+    // Joaat over the lowercased bytes, same as alt::ICore::Hash
+    constexpr uint32_t HashString(std::string_view str)
+    {
+        uint32_t result = 0;
+        for(char c : str)
+        {
+            result += (uint32_t)((c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : (unsigned char)c);
+            result += result << 10;
+            result ^= result >> 6;
+        }
+        result += result << 3;
+        result ^= result >> 11;
+        result += result << 15;
+        return result;
+    }
+    // Same as alt::ICore::Hash, but hashes the string without copying it to the heap
+    uint32_t HashString(v8::Isolate* isolate, v8::Local<v8::String> str);
 }  // namespace js
@@ -0,0 +1,78 @@
+#include "ErrorTracker.h"
+#include "JS.h"
+#include "Logger.h"
+
+#include <chrono>
+
+double js::ErrorTracker::GetTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void js::ErrorTracker::LogSummary(Fingerprint& fingerprint)
+{
+    Logger::Error("[JS] Exception '" + fingerprint.message + "' in file '" + fingerprint.file + "' at line " + std::to_string(fingerprint.line) + " repeated " +
+                  std::to_string(fingerprint.pendingSuppressed) + " more times");
+    fingerprint.pendingSuppressed = 0;
+}
+
+bool js::ErrorTracker::Track(IResource* resource, const std::string& message, const std::string& file, int line)
+{
+    if(maxReports == 0) return true;
+
+    double now = GetTime();
+    std::string key = file + ':' + std::to_string(line) + ':' + message;
+    auto it = fingerprints.find(key);
+    if(it == fingerprints.end())
+    {
+        // Errors with new fingerprints are always reported once the table is full, so nothing is lost
+        if(fingerprints.size() >= maxFingerprints) return true;
+
+        Fingerprint fingerprint;
+        fingerprint.message = message;
+        fingerprint.file = (file.empty() || file == "undefined") ? "<unknown>" : PrettifyFilePath(resource, file);
+        fingerprint.line = line;
+        fingerprint.windowStart = now;
+        it = fingerprints.insert({ std::move(key), std::move(fingerprint) }).first;
+    }
+
+    Fingerprint& fingerprint = it->second;
+    fingerprint.count++;
+    if(now - fingerprint.windowStart >= window)
+    {
+        if(fingerprint.pendingSuppressed > 0) LogSummary(fingerprint);
+        fingerprint.windowStart = now;
+        fingerprint.windowReports = 0;
+    }
+    if(fingerprint.windowReports < maxReports)
+    {
+        fingerprint.windowReports++;
+        return true;
+    }
+
+    fingerprint.suppressed++;
+    fingerprint.pendingSuppressed++;
+    return false;
+}
+
+void js::ErrorTracker::LogSummaries()
+{
+    if(fingerprints.empty()) return;
+    double now = GetTime();
+    if(now - lastSummary < summaryInterval) return;
+    lastSummary = now;
+
+    // Fingerprints of errors that were not thrown for a whole window are removed after their summary,
+    // so the table doesn't fill up with old errors and new errors are still rate limited
+    for(auto it = fingerprints.begin(); it != fingerprints.end();)
+    {
+        Fingerprint& fingerprint = it->second;
+        if(now - fingerprint.windowStart < window)
+        {
+            ++it;
+            continue;
+        }
+        if(fingerprint.pendingSuppressed > 0) LogSummary(fingerprint);
+        it = fingerprints.erase(it);
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+namespace js
+{
+    class IResource;
+
+    // Fingerprints errors by message and location, so an error thrown over and over (e.g. by a handler every tick)
+    // is only fully reported a few times per window, further occurrences are counted and logged as a single summary
+    class ErrorTracker
+    {
+    public:
+        struct Fingerprint
+        {
+            std::string message;
+            std::string file;
+            int line = 0;
+            uint64_t count = 0;
+            uint64_t suppressed = 0;
+            // Suppressed since the last "repeated N times" summary
+            uint64_t pendingSuppressed = 0;
+            double windowStart = 0;
+            uint32_t windowReports = 0;
+        };
+
+    private:
+        static constexpr size_t maxFingerprints = 1024;
+        static constexpr double summaryInterval = 1;  // In seconds
+        static inline uint32_t maxReports = 5;
+        static inline double window = 10;  // In seconds
+
+        std::unordered_map<std::string, Fingerprint> fingerprints;
+        double lastSummary = 0;
+
+        static double GetTime();
+        static void LogSummary(Fingerprint& fingerprint);
+
+    public:
+        // Allows up to `maxReports` full reports of the same error per `window` seconds, 0 disables the limit
+        static void SetRateLimit(uint32_t _maxReports, double _window)
+        {
+            maxReports = _maxReports;
+            window = _window;
+        }
+
+        // Returns whether the error should be reported, the file is the unprettified script name
+        bool Track(IResource* resource, const std::string& message, const std::string& file, int line);
+        // Logs the summaries of errors that stopped being thrown after their reports were limited, and removes errors not thrown for a whole window
+        void LogSummaries();
+
+        void Clear()
+        {
+            fingerprints.clear();
+            lastSummary = 0;
+        }
+        void ResetCounts()
+        {
+            for(auto& [key, fingerprint] : fingerprints)
+            {
+                fingerprint.count = 0;
+                fingerprint.suppressed = 0;
+            }
+        }
+
+        const std::unordered_map<std::string, Fingerprint>& GetFingerprints() const
+        {
+            return fingerprints;
+        }
+    };
+}  // namespace js
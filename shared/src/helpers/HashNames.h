@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+namespace js
+{
+    // Gets the known vehicle, ped or weapon model name for the hash, or nullptr if the hash is unknown
+    // The table is generated by tools/generate-hash-names.js from the name lists in tools/hash-names
+    const char* GetHashName(uint32_t hash);
+}  // namespace js
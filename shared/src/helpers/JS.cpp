@@ -3,7 +3,7 @@
 
 #include <filesystem>
 
-static std::string PrettifyFilePath(js::IResource* resource, std::string path)
+std::string js::PrettifyFilePath(IResource* resource, std::string path)
 {
     if(path.starts_with("file:///")) path = path.substr(8);
 
@@ -22,6 +22,11 @@ static std::string PrettifyFilePath(js::IResource* resource, std::string path)
 }
 
 js::SourceLocation js::GetCurrentSourceLocation(IResource* resource, int framesToSkip)
+{
+    return ResolveSourceLocation(resource, CaptureSourceLocation(resource, framesToSkip));
+}
+
+js::SourceLocationToken js::CaptureSourceLocation(IResource* resource, int framesToSkip)
 {
     v8::Isolate* isolate = resource->GetIsolate();
     v8::Local<v8::StackTrace> stackTrace = v8::StackTrace::CurrentStackTrace(isolate, framesToSkip + 5);
@@ -29,11 +34,30 @@ js::SourceLocation js::GetCurrentSourceLocation(IResource* resource, int framesT
     {
         v8::Local<v8::StackFrame> frame = stackTrace->GetFrame(isolate, i);
         if(!frame->IsUserJavaScript()) continue;
-        std::string scriptName = CppValue(frame->GetScriptName());
-        if(scriptName.empty() || scriptName.starts_with("internal:")) continue;
-        return SourceLocation{ PrettifyFilePath(resource, scriptName), frame->GetLineNumber() };
+
+        // The script name is only converted and prettified the first time a script is seen
+        int scriptId = frame->GetScriptId();
+        const std::string* scriptName = resource->GetScriptName(scriptId);
+        if(!scriptName)
+        {
+            std::string name = CppValue(frame->GetScriptName());
+            if(name.empty() || name.starts_with("internal:")) name.clear();
+            else
+                name = PrettifyFilePath(resource, name);
+            scriptName = &resource->SetScriptName(scriptId, name);
+        }
+        if(scriptName->empty()) continue;
+        return SourceLocationToken{ scriptId, frame->GetLineNumber() };
     }
-    return SourceLocation{};
+    return SourceLocationToken{};
+}
+
+js::SourceLocation js::ResolveSourceLocation(IResource* resource, SourceLocationToken token)
+{
+    if(!token.IsValid()) return SourceLocation{};
+    const std::string* scriptName = resource->GetScriptName(token.scriptId);
+    if(!scriptName || scriptName->empty()) return SourceLocation{};
+    return SourceLocation{ *scriptName, token.line };
 }
 
 void js::RunEventLoop()
@@ -50,18 +74,19 @@ void js::TryCatch::PrintError()
     v8::Local<v8::Message> message = tryCatch.Message();
     if(exception.IsEmpty() || message.IsEmpty()) return;
 
-    v8::MaybeLocal<v8::String> maybeSourceLine = message->GetSourceLine(context);
-    std::string sourceLine = maybeSourceLine.IsEmpty() ? "" : *v8::String::Utf8Value(isolate, maybeSourceLine.ToLocalChecked());
+    // Only the parts needed for the fingerprint are extracted before checking whether the error should be reported
+    std::string exceptionStr = *v8::String::Utf8Value(isolate, exception);
     int32_t line = message->GetLineNumber(context).FromMaybe(0);
-    std::string lineStr = line == 0 ? "<unknown>" : std::to_string(line);
     std::string file = *v8::String::Utf8Value(isolate, message->GetScriptOrigin().ResourceName());
+    if(!resource->GetErrorTracker().Track(resource, exceptionStr, file, line)) return;
+
+    std::string lineStr = line == 0 ? "<unknown>" : std::to_string(line);
     if(file.empty() || file == "undefined") file = "<unknown>";
     else
         file = PrettifyFilePath(resource, file);
 
     v8::MaybeLocal<v8::Value> stackTrace = tryCatch.StackTrace(context);
     std::string stack = stackTrace.IsEmpty() ? "" : *v8::String::Utf8Value(isolate, stackTrace.ToLocalChecked());
-    std::string exceptionStr = *v8::String::Utf8Value(isolate, exception);
 
     Logger::Error("[JS] Exception caught in resource '" + resource->GetResource()->GetName() + "' in file '" + file + "' at line " + lineStr);
     if(!exceptionStr.empty() && stack.empty()) Logger::Error("[JS]", exceptionStr);
@@ -19,6 +19,10 @@ namespace js
     {
         v8::Isolate::GetCurrent()->ThrowException(v8::Exception::Error(js::JSValue(message)));
     }
+    static void Throw(const char* message)
+    {
+        v8::Isolate::GetCurrent()->ThrowException(v8::Exception::Error(js::JSValue(message)));
+    }
 
     struct SourceLocation
     {
@@ -31,6 +35,37 @@ namespace js
     };
     SourceLocation GetCurrentSourceLocation(IResource* resource, int framesToSkip = 0);
 
+    // Cheap reference to a source location, only resolved to the file name when it is displayed
+    struct SourceLocationToken
+    {
+        int scriptId = 0;
+        int line = 0;
+
+        bool IsValid() const
+        {
+            return line != 0;
+        }
+
+        // Packs the token into a single number for JS, script ids and lines both fit into the 53 bits of a double
+        double ToNumber() const
+        {
+            return (double)scriptId * lineLimit + line;
+        }
+        static SourceLocationToken FromNumber(double number)
+        {
+            if(number <= 0) return SourceLocationToken{};
+            int64_t value = (int64_t)number;
+            return SourceLocationToken{ (int)(value / lineLimit), (int)(value % lineLimit) };
+        }
+
+    private:
+        static constexpr int64_t lineLimit = 1 << 21;
+    };
+    SourceLocationToken CaptureSourceLocation(IResource* resource, int framesToSkip = 0);
+    SourceLocation ResolveSourceLocation(IResource* resource, SourceLocationToken token);
+    // Makes the path relative to the resource directory
+    std::string PrettifyFilePath(IResource* resource, std::string path);
+
     void RunEventLoop();
 
     class TryCatch
@@ -116,52 +151,97 @@ namespace js
         }
 
         template<typename T>
-        void Set(const std::string& key, const T& val)
+        void Set(v8::Local<v8::String> key, const T& val)
         {
             using Type = std::conditional_t<std::is_enum_v<T>, int, T>;
             static_assert(IsJSValueConvertible<Type>, "Type is not convertible to JS value");
-            object->Set(context, js::JSValue(key), js::JSValue((Type)val));
+            object->Set(context, key, js::JSValue((Type)val));
+        }
+        template<typename T>
+        void Set(const std::string& key, const T& val)
+        {
+            Set<T>(js::JSValue(key), val);
+        }
+        // Char array keys use the interned string if the key is in the table, the table is never extended here
+        template<typename T, size_t N>
+        void Set(const char (&key)[N], const T& val)
+        {
+            Set<T>(GetKey(key), val);
         }
 
         void SetMethod(const std::string& key, FunctionCallback func);
 
-        // Falls back to default value if the value is not found or the type doesn't match
+    private:
+        static v8::Local<v8::String> GetKey(std::string_view key)
+        {
+            v8::Local<v8::String> str = StringTable::Find(v8::Isolate::GetCurrent(), key);
+            return str.IsEmpty() ? js::JSValue(std::string(key)) : str;
+        }
+
         template<typename T>
-        T Get(const std::string& key, const T& defaultValue = T()) const
+        T GetValue(v8::Local<v8::String> key, const T& defaultValue) const
         {
-            v8::MaybeLocal<v8::Value> maybeVal = object->Get(context, js::JSValue(key));
+            v8::MaybeLocal<v8::Value> maybeVal = object->Get(context, key);
             v8::Local<v8::Value> val;
             if(!maybeVal.ToLocal(&val)) return defaultValue;
             std::optional<T> result = js::CppValue<T>(val);
             return result.has_value() ? (T)result.value() : defaultValue;
         }
-
-        // Throws an error and returns false if the value is not found or the type doesn't match
         template<typename T>
-        bool Get(const std::string& key, T& out, bool throwOnError = true)
+        bool GetValue(v8::Local<v8::String> key, std::string_view keyName, T& out, bool throwOnError)
         {
             using Type = std::conditional_t<std::is_enum_v<T>, int, T>;
-            v8::MaybeLocal<v8::Value> maybeVal = object->Get(context, js::JSValue(key));
+            v8::MaybeLocal<v8::Value> maybeVal = object->Get(context, key);
             v8::Local<v8::Value> val;
             if(!maybeVal.ToLocal(&val))
             {
-                if(throwOnError) Throw("Failed to get property '" + key + "', value not found");
+                if(throwOnError) Throw("Failed to get property '" + std::string(keyName) + "', value not found");
                 return false;
             }
             std::optional<Type> result = js::CppValue<Type>(val);
             if(!result.has_value())
             {
-                if(throwOnError) Throw("Failed to get property '" + key + "', invalid type");
+                if(throwOnError) Throw("Failed to get property '" + std::string(keyName) + "', invalid type");
                 return false;
             }
             out = (T)result.value();
             return true;
         }
 
+    public:
+        // Falls back to default value if the value is not found or the type doesn't match
+        template<typename T>
+        T Get(const std::string& key, const T& defaultValue = T()) const
+        {
+            return GetValue<T>(js::JSValue(key), defaultValue);
+        }
+        template<typename T, size_t N>
+        T Get(const char (&key)[N], const T& defaultValue = T()) const
+        {
+            return GetValue<T>(GetKey(key), defaultValue);
+        }
+
+        // Throws an error and returns false if the value is not found or the type doesn't match
+        template<typename T>
+        bool Get(const std::string& key, T& out, bool throwOnError = true)
+        {
+            return GetValue<T>(js::JSValue(key), key, out, throwOnError);
+        }
+        template<typename T, size_t N>
+        bool Get(const char (&key)[N], T& out, bool throwOnError = true)
+        {
+            return GetValue<T>(GetKey(key), key, out, throwOnError);
+        }
+
         bool Has(const std::string& key) const
         {
             return object->HasOwnProperty(context, js::JSValue(key)).FromMaybe(false);
         }
+        template<size_t N>
+        bool Has(const char (&key)[N]) const
+        {
+            return object->HasOwnProperty(context, GetKey(key)).FromMaybe(false);
+        }
 
         std::vector<std::string> GetKeys() const
         {
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "cpp-sdk/SDK.h"
+#include "CallContext.h"
+#include "Event.h"
+#include "interfaces/IResource.h"
+
+namespace js
+{
+    // Converts the object passed as the first argument in a single pass, applies all of its keys with the setter
+    // and sends one META_BATCH_CHANGE event listing the changed keys to every resource of the runtime,
+    // so listeners can handle the batch at once (the core still sends its change event per key)
+    // The object is nullptr for global meta
+    template<typename Setter>
+    void SetMetaBatch(FunctionContext& ctx, const char* metaType, alt::IBaseObject* object, Setter&& setter)
+    {
+        if(!ctx.CheckArgCount(1)) return;
+
+        v8::Local<v8::Value> value;
+        if(!ctx.GetArg(0, value, Type::OBJECT)) return;
+
+        alt::MValueDict dict = std::dynamic_pointer_cast<alt::IMValueDict>(JSToMValue(value));
+        if(!ctx.Check(dict != nullptr, "Failed to convert meta values")) return;
+
+        MetaCache& cache = ctx.GetResource()->GetMetaCache();
+        std::vector<std::string> keys;
+        for(auto it = dict->Begin(); it; it = dict->Next())
+        {
+            std::string key = it->GetKey();
+            setter(key, it->GetValue());
+            cache.Invalidate(object, key);
+            keys.push_back(std::move(key));
+        }
+        if(keys.empty()) return;
+
+        // Listeners are usually in other resources, the arguments are created in the context of every resource
+        IResource* sender = ctx.GetResource();
+        for(alt::IResource* altResource : alt::ICore::Instance().GetAllResources())
+        {
+            if(altResource->GetType() != "jsv2") continue;
+            IResource* resource = static_cast<IResource*>(altResource->GetImpl());
+            if(resource != sender && !altResource->IsStarted()) continue;
+
+            v8::Context::Scope contextScope(resource->GetContext());
+            Event::EventArgs args;
+            args.Set("object", object);
+            args.Set("metaType", metaType);
+            args.Set("keys", keys);
+            Event::SendEvent(EventType::META_BATCH_CHANGE, args, resource);
+        }
+    }
+}  // namespace js
@@ -0,0 +1,52 @@
+#include "MetaCache.h"
+
+void js::MetaCache::Invalidate(const alt::CEvent* ev)
+{
+    switch(ev->GetType())
+    {
+        case alt::CEvent::Type::LOCAL_SYNCED_META_CHANGE:
+        {
+            auto e = static_cast<const alt::CLocalMetaDataChangeEvent*>(ev);
+            Invalidate(e->GetTarget(), Type::LOCAL_META, e->GetKey());
+            break;
+        }
+        case alt::CEvent::Type::SYNCED_META_CHANGE:
+        {
+            auto e = static_cast<const alt::CSyncedMetaDataChangeEvent*>(ev);
+            Invalidate(e->GetTarget(), Type::SYNCED_META, e->GetKey());
+            break;
+        }
+        case alt::CEvent::Type::STREAM_SYNCED_META_CHANGE:
+        {
+            auto e = static_cast<const alt::CStreamSyncedMetaDataChangeEvent*>(ev);
+            Invalidate(e->GetTarget(), Type::STREAM_SYNCED_META, e->GetKey());
+            break;
+        }
+        case alt::CEvent::Type::GLOBAL_SYNCED_META_CHANGE:
+        {
+            auto e = static_cast<const alt::CGlobalMetaDataChangeEvent*>(ev);
+            Invalidate(nullptr, Type::GLOBAL_SYNCED_META, e->GetKey());
+            break;
+        }
+        default: break;
+    }
+}
+
+void js::DeepFreeze(v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+{
+    if(!value->IsObject()) return;
+    v8::Local<v8::Object> obj = value.As<v8::Object>();
+    // Don't freeze base object instances, they are shared with the rest of the resource
+    if(obj->InternalFieldCount() > 0) return;
+    if(obj->SetIntegrityLevel(context, v8::IntegrityLevel::kFrozen).IsNothing()) return;
+
+    v8::Local<v8::Array> keys;
+    if(!obj->GetOwnPropertyNames(context).ToLocal(&keys)) return;
+    for(uint32_t i = 0; i < keys->Length(); i++)
+    {
+        v8::Local<v8::Value> key;
+        v8::Local<v8::Value> child;
+        if(!keys->Get(context, i).ToLocal(&key) || !obj->Get(context, key).ToLocal(&child)) continue;
+        DeepFreeze(context, child);
+    }
+}
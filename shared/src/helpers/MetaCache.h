@@ -0,0 +1,156 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+
+#include "v8.h"
+#include "cpp-sdk/SDK.h"
+#include "JS.h"
+#include "CallContext.h"
+
+namespace js
+{
+    // Optional per tick cache of converted meta values, so reading the same large meta value
+    // multiple times in a tick returns the same frozen JS value instead of converting it again
+    // Entries are invalidated when the meta is changed or deleted, and the whole cache is cleared every tick
+    // Only meta types with change events are cached, the resource keeps these events enabled in the core while
+    // the cache is enabled, so changes by other resources and the core are noticed too
+    class MetaCache
+    {
+    public:
+        enum class Type : uint8_t
+        {
+            SYNCED_META,
+            STREAM_SYNCED_META,
+            LOCAL_META,
+            GLOBAL_SYNCED_META,
+
+            SIZE
+        };
+
+    private:
+        using Values = std::array<Persistent<v8::Value>, (size_t)Type::SIZE>;
+        // Global meta uses nullptr as owner
+        std::unordered_map<alt::IBaseObject*, std::unordered_map<std::string, Values>> owners;
+
+        bool enabled = false;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+
+    public:
+        // The events the cache entries are invalidated by
+        static constexpr std::array<alt::CEvent::Type, 4> invalidationEvents = { alt::CEvent::Type::SYNCED_META_CHANGE,
+                                                                                 alt::CEvent::Type::STREAM_SYNCED_META_CHANGE,
+                                                                                 alt::CEvent::Type::LOCAL_SYNCED_META_CHANGE,
+                                                                                 alt::CEvent::Type::GLOBAL_SYNCED_META_CHANGE };
+        static bool IsInvalidationEvent(alt::CEvent::Type type)
+        {
+            return std::find(invalidationEvents.begin(), invalidationEvents.end(), type) != invalidationEvents.end();
+        }
+
+        bool IsEnabled() const
+        {
+            return enabled;
+        }
+        void SetEnabled(bool state)
+        {
+            enabled = state;
+            if(!enabled) Clear();
+        }
+
+        // Returns an empty handle if the value is not cached
+        v8::Local<v8::Value> Get(v8::Isolate* isolate, alt::IBaseObject* owner, Type type, const std::string& key)
+        {
+            auto ownerIt = owners.find(owner);
+            if(ownerIt != owners.end())
+            {
+                auto keyIt = ownerIt->second.find(key);
+                if(keyIt != ownerIt->second.end() && !keyIt->second[(size_t)type].IsEmpty())
+                {
+                    hits++;
+                    return keyIt->second[(size_t)type].Get(isolate);
+                }
+            }
+            misses++;
+            return v8::Local<v8::Value>();
+        }
+        void Set(v8::Isolate* isolate, alt::IBaseObject* owner, Type type, const std::string& key, v8::Local<v8::Value> value)
+        {
+            owners[owner][key][(size_t)type].Reset(isolate, value);
+        }
+
+        void Invalidate(alt::IBaseObject* owner, Type type, const std::string& key)
+        {
+            auto ownerIt = owners.find(owner);
+            if(ownerIt == owners.end()) return;
+            auto keyIt = ownerIt->second.find(key);
+            if(keyIt == ownerIt->second.end()) return;
+            keyIt->second[(size_t)type].Reset();
+        }
+        // Invalidates the key for all meta types of the owner
+        void Invalidate(alt::IBaseObject* owner, const std::string& key)
+        {
+            auto ownerIt = owners.find(owner);
+            if(ownerIt == owners.end()) return;
+            ownerIt->second.erase(key);
+        }
+        void Invalidate(alt::IBaseObject* owner)
+        {
+            owners.erase(owner);
+        }
+        // Invalidates the entry for the meta change event
+        void Invalidate(const alt::CEvent* ev);
+
+        void Clear()
+        {
+            owners.clear();
+        }
+        void ResetStats()
+        {
+            hits = 0;
+            misses = 0;
+        }
+
+        uint64_t GetHits() const
+        {
+            return hits;
+        }
+        uint64_t GetMisses() const
+        {
+            return misses;
+        }
+        size_t GetSize() const
+        {
+            size_t size = 0;
+            for(auto& [owner, keys] : owners) size += keys.size();
+            return size;
+        }
+    };
+
+    // Freezes the value and all objects and arrays it contains
+    void DeepFreeze(v8::Local<v8::Context> context, v8::Local<v8::Value> value);
+
+    // Returns the cached meta value if the cache is enabled, otherwise the value from the getter is converted (and cached)
+    template<typename Getter>
+    void ReturnMeta(DynamicPropertyGetterContext& ctx, MetaCache& cache, alt::IBaseObject* owner, MetaCache::Type type, Getter&& getter)
+    {
+        if(!cache.IsEnabled())
+        {
+            ctx.Return(getter());
+            return;
+        }
+
+        v8::Isolate* isolate = ctx.GetIsolate();
+        v8::Local<v8::Value> value = cache.Get(isolate, owner, type, ctx.GetProperty());
+        if(value.IsEmpty())
+        {
+            value = MValueToJS(getter());
+            if(value.IsEmpty()) return;
+            DeepFreeze(ctx.GetContext(), value);
+            cache.Set(isolate, owner, type, ctx.GetProperty(), value);
+        }
+        ctx.Return(value);
+    }
+}  // namespace js
@@ -0,0 +1,31 @@
+#include "StringTable.h"
+
+// clang-format off
+static constexpr std::string_view commonKeys[] = {
+    // Vector, color and quaternion components
+    "x", "y", "z", "w", "r", "g", "b", "a",
+
+    // Event arguments
+    "additionalBodyHealthDamage", "ammoHash", "args", "armourDamage", "attachedVehicle", "attacker", "bodyHealthDamage", "bodyPart",
+    "branch", "cdnUrl", "colShape", "command", "damage", "detachedVehicle", "dir", "discordId", "engineHealthDamage", "entity", "error",
+    "eventName", "fires", "fx", "healthDamage", "ip", "isDebug", "key", "keys", "killer", "metaType", "name", "newAnimDict", "newAnimName", "newDimension",
+    "newInterior", "newOwner", "newSeat", "newValue", "newWeapon", "object", "offset", "oldAnimDict", "oldAnimName", "oldDimension",
+    "oldInterior", "oldOwner", "oldSeat", "oldValue", "oldWeapon", "passwordHash", "petrolTankDamage", "player", "pos", "reason",
+    "resource", "seat", "source", "stack", "state", "target", "type", "vehicle", "version", "weaponHash",
+};
+// clang-format on
+
+void js::StringTable::Initialize(v8::Isolate* isolate)
+{
+    Cleanup();
+    instance = new StringTable();
+    instanceIsolate = isolate;
+    for(std::string_view key : commonKeys) instance->Add(isolate, key);
+}
+
+void js::StringTable::Cleanup()
+{
+    delete instance;
+    instance = nullptr;
+    instanceIsolate = nullptr;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "v8.h"
+
+namespace js
+{
+    // A key known at compile time, the consteval constructor only accepts constant strings like literals,
+    // so keys built at runtime can't be added to the string table
+    class StringKey
+    {
+        std::string_view str;
+
+    public:
+        template<size_t N>
+        consteval StringKey(const char (&_str)[N]) : str(_str, N - 1)
+        {
+        }
+
+        std::string_view Get() const
+        {
+            return str;
+        }
+    };
+
+    // Per isolate table of internalized strings for fixed keys like property and event argument names
+    // Looking up a property with an internalized key skips the string table lookup V8 would do otherwise,
+    // and the key doesn't have to be created again on every call
+    // The runtime owns the table of its isolate, the isolate data slots are left to the embedder
+    class StringTable
+    {
+        static inline StringTable* instance = nullptr;
+        static inline v8::Isolate* instanceIsolate = nullptr;
+
+        struct Hash
+        {
+            using is_transparent = void;
+
+            size_t operator()(std::string_view str) const
+            {
+                return std::hash<std::string_view>{}(str);
+            }
+        };
+
+        std::unordered_map<std::string, v8::Eternal<v8::String>, Hash, std::equal_to<>> table;
+
+        // Other isolates, e.g. of worker threads, have no table
+        static StringTable* GetTable(v8::Isolate* isolate)
+        {
+            return isolate == instanceIsolate ? instance : nullptr;
+        }
+
+        v8::Local<v8::String> Add(v8::Isolate* isolate, std::string_view str)
+        {
+            auto it = table.find(str);
+            if(it != table.end()) return it->second.Get(isolate);
+
+            v8::Local<v8::String> value =
+              v8::String::NewFromUtf8(isolate, str.data(), v8::NewStringType::kInternalized, (int)str.size()).ToLocalChecked();
+            table.emplace(std::string(str), v8::Eternal<v8::String>(isolate, value));
+            return value;
+        }
+
+    public:
+        // Creates the table and adds the commonly used keys, has to be called while a handle scope is active
+        static void Initialize(v8::Isolate* isolate);
+        // Deletes the table, has to be called by the runtime before its isolate is disposed
+        static void Cleanup();
+
+        // Keys not in the table yet are added, the key type makes sure only constant keys can be added
+        static v8::Local<v8::String> Get(v8::Isolate* isolate, StringKey key)
+        {
+            StringTable* stringTable = GetTable(isolate);
+            if(!stringTable) return v8::String::NewFromUtf8(isolate, key.Get().data(), v8::NewStringType::kInternalized, (int)key.Get().size()).ToLocalChecked();
+            return stringTable->Add(isolate, key.Get());
+        }
+
+        // Returns an empty handle if the key is not in the table, the table is never extended
+        static v8::Local<v8::String> Find(v8::Isolate* isolate, std::string_view key)
+        {
+            StringTable* stringTable = GetTable(isolate);
+            if(!stringTable) return v8::Local<v8::String>();
+            auto it = stringTable->table.find(key);
+            if(it == stringTable->table.end()) return v8::Local<v8::String>();
+            return it->second.Get(isolate);
+        }
+
+        static size_t GetSize(v8::Isolate* isolate)
+        {
+            StringTable* stringTable = GetTable(isolate);
+            return stringTable ? stringTable->table.size() : 0;
+        }
+    };
+
+    // Returns the interned string for a fixed key
+    inline v8::Local<v8::String> JSKey(StringKey key)
+    {
+        return StringTable::Get(v8::Isolate::GetCurrent(), key);
+    }
+}  // namespace js
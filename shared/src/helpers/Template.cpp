@@ -131,6 +131,13 @@ void js::ClassTemplate::BindToType(alt::IBaseObject::Type type)
     IScriptObjectHandler::BindClassToType(type, class_);
 }
 
+#ifdef DEBUG_ALLOCATIONS
+void js::ClassTemplate::RegisterBindingName(const void* binding, const std::string& name)
+{
+    BindingStats::RegisterName(binding, class_->GetName() + "." + name);
+}
+#endif
+
 #ifdef DEBUG_BINDINGS
 void js::ClassTemplate::DumpRegisteredKeys()
 {
@@ -9,6 +9,7 @@
 #include "CallContext.h"
 #include "Logger.h"
 #include "Callbacks.h"
+#include "BindingStats.h"
 
 template<auto x>
 struct function_traits;
@@ -47,16 +48,28 @@ namespace js
 
         static void FunctionHandler(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
-            FunctionContext ctx{ info };
             auto callback = reinterpret_cast<FunctionCallback>(info.Data().As<v8::External>()->Value());
+#ifdef DEBUG_ALLOCATIONS
+            BindingStats::Scope stats{ (void*)callback };
+#endif
+            FunctionContext ctx{ info };
             callback(ctx);
+#ifdef DEBUG_ALLOCATIONS
+            stats.SetErrored(ctx.Errored());
+#endif
         }
 
         static void PropertyHandler(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
-            PropertyContext ctx{ info, info[0] };
             auto callback = reinterpret_cast<PropertyCallback>(info.Data().As<v8::External>()->Value());
+#ifdef DEBUG_ALLOCATIONS
+            BindingStats::Scope stats{ (void*)callback };
+#endif
+            PropertyContext ctx{ info, info[0] };
             callback(ctx);
+#ifdef DEBUG_ALLOCATIONS
+            stats.SetErrored(ctx.Errored());
+#endif
         }
 
         static void LazyPropertyHandler(v8::Local<v8::Name>, const v8::PropertyCallbackInfo<v8::Value>& info)
@@ -95,6 +108,9 @@ namespace js
             using Return = FT::ReturnType;
             using Arguments = FT::Arguments;
 
+#ifdef DEBUG_ALLOCATIONS
+            BindingStats::Scope stats{ (void*)&MethodHandler<Func> };
+#endif
             FunctionContext ctx{ info };
             if(!ctx.CheckThis()) return;
 
@@ -117,6 +133,9 @@ namespace js
             }
             catch(BadArgException& e)
             {
+#ifdef DEBUG_ALLOCATIONS
+                stats.SetErrored(true);
+#endif
                 js::Throw(e.what());
             }
         }
@@ -224,6 +243,10 @@ namespace js
         }
         void StaticProperty(const std::string& name, PropertyCallback getter, PropertyCallback setter = nullptr)
         {
+#ifdef DEBUG_ALLOCATIONS
+            BindingStats::RegisterName((void*)getter, name + " (getter)");
+            if(setter) BindingStats::RegisterName((void*)setter, name + " (setter)");
+#endif
             // todo: use native data property
             Get()->SetAccessorProperty(js::JSValue(name), WrapProperty(getter), setter ? WrapProperty(setter) : v8::Local<v8::FunctionTemplate>());
         }
@@ -245,6 +268,9 @@ namespace js
 
         void StaticFunction(const std::string& name, FunctionCallback callback)
         {
+#ifdef DEBUG_ALLOCATIONS
+            BindingStats::RegisterName((void*)callback, name);
+#endif
             Get()->Set(js::JSValue(name), WrapFunction(callback), (v8::PropertyAttribute)(v8::PropertyAttribute::ReadOnly | v8::PropertyAttribute::DontDelete));
         }
     };
@@ -285,6 +311,10 @@ namespace js
             registeredKeys.insert({ key, type });
         }
 #endif
+#ifdef DEBUG_ALLOCATIONS
+        // Prefixes the name with the class name
+        void RegisterBindingName(const void* binding, const std::string& name);
+#endif
 
         template<class T>
         using ClassMap = std::unordered_map<v8::Isolate*, std::unordered_map<Class*, T>>;
@@ -344,6 +374,9 @@ namespace js
         template<auto Func>
         void Method(const std::string& name)
         {
+#ifdef DEBUG_ALLOCATIONS
+            RegisterBindingName((void*)&Wrapper::MethodHandler<Func>, name);
+#endif
             Get()->PrototypeTemplate()->Set(js::JSValue(name), v8::FunctionTemplate::New(GetIsolate(), Wrapper::MethodHandler<Func>));
         }
 
@@ -355,6 +388,9 @@ namespace js
         {
 #ifdef DEBUG_BINDINGS
             RegisterKey("Method", name);
+#endif
+#ifdef DEBUG_ALLOCATIONS
+            RegisterBindingName((void*)callback, name);
 #endif
             Get()->PrototypeTemplate()->Set(js::JSValue(name), WrapFunction(callback));
         }
@@ -383,6 +419,10 @@ namespace js
         {
 #ifdef DEBUG_BINDINGS
             RegisterKey("Property", name);
+#endif
+#ifdef DEBUG_ALLOCATIONS
+            if(getter) RegisterBindingName((void*)getter, name + " (getter)");
+            if(setter) RegisterBindingName((void*)setter, name + " (setter)");
 #endif
             if(getter && !setter)
             {
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <type_traits>
+#include <unordered_set>
 
 #include "v8.h"
 #include "cpp-sdk/SDK.h"
@@ -11,6 +12,9 @@
 #include "Module.h"
 #include "IScriptObjectHandler.h"
 #include "Event.h"
+#include "MetaEventHandlers.h"
+#include "helpers/MetaCache.h"
+#include "helpers/ErrorTracker.h"
 #include "Logger.h"
 
 namespace js
@@ -44,13 +48,30 @@ namespace js
 
         std::unordered_map<alt::IResource*, Persistent<v8::Object>> resourceObjects;
 
+        // Amount of handlers registered via the JS bindings per event type, used to skip sending events nothing in JS listens to
+        std::unordered_map<alt::CEvent::Type, uint32_t> jsEventHandlerCounts;
+        bool hasGenericEventHandlers = false;
+        // Events are toggled globally in the core, so they are only disabled once no resource of the runtime uses them anymore
+        static inline std::unordered_map<alt::CEvent::Type, uint32_t> coreEventUserCounts;
+        // Events this resource is counted as a user of
+        std::unordered_set<alt::CEvent::Type> usedCoreEvents;
+        MetaEventHandlers metaEventHandlers;
+        MetaCache metaCache;
+        ErrorTracker errorTracker;
+        // Prettified script names by script id, empty for scripts that are skipped in source locations
+        std::unordered_map<int, std::string> scriptNames;
+
         void Initialize()
         {
             context.Get(isolate)->SetAlignedPointerInEmbedderData(ContextInternalFieldIdx, this);
+            IScriptObjectHandler::InitializeCollections();
         }
 
         void Reset()
         {
+            // Queued log entries still point to the resource
+            LogWriter::Instance().Flush();
+
             Binding::CleanupForResource(this);
             Module::CleanupForResource(this);
             IScriptObjectHandler::Reset();
@@ -61,6 +82,17 @@ namespace js
             context.Reset();
             bindingExports.clear();
             resourceObjects.clear();
+            jsEventHandlerCounts.clear();
+            hasGenericEventHandlers = false;
+            for(alt::CEvent::Type type : usedCoreEvents)
+            {
+                if(--coreEventUserCounts[type] == 0) alt::ICore::Instance().ToggleEvent(type, false);
+            }
+            usedCoreEvents.clear();
+            metaEventHandlers.Clear();
+            metaCache.Clear();
+            errorTracker.Clear();
+            scriptNames.clear();
         }
 
         void InitializeBinding(Binding* binding);
@@ -84,7 +116,7 @@ namespace js
 
         void OnCreateBaseObject(alt::IBaseObject* object) override
         {
-            // IScriptObjectHandler::GetOrCreateScriptObject(GetContext(), object);
+            IScriptObjectHandler::AddToCollections(object);
         }
 
         void OnRemoveBaseObject(alt::IBaseObject* object) override
@@ -94,6 +126,8 @@ namespace js
             v8::HandleScope handleScope(isolate);
             v8::Context::Scope contextScope(GetContext());
 
+            metaCache.Invalidate(object);
+            IScriptObjectHandler::RemoveFromCollections(object);
             IScriptObjectHandler::DestroyScriptObject(object);
         }
 
@@ -106,7 +140,11 @@ namespace js
 
             if(ev->GetType() == alt::CEvent::Type::RESOURCE_STOP) DestroyResourceObject(static_cast<const alt::CResourceStopEvent*>(ev)->GetResource());
 
-            Event::SendEvent(ev, this);
+            if(metaCache.IsEnabled() && MetaEventHandlers::IsMetaEvent(ev->GetType())) metaCache.Invalidate(ev);
+            // Events are only converted for JS if there are handlers for them, e.g. events enabled for object or key filtered meta handlers
+            // are still received when no JS handler is subscribed, those handlers are called natively
+            if(HasJSEventHandlers(ev->GetType())) Event::SendEvent(ev, this);
+            metaEventHandlers.Dispatch(ev, this);
         }
 
         void OnTick() override
@@ -116,6 +154,8 @@ namespace js
             v8::HandleScope handleScope(isolate);
             v8::Context::Scope contextScope(GetContext());
 
+            metaCache.Clear();
+            errorTracker.LogSummaries();
             js::Function onTick = GetBindingExport<v8::Function>("timers:tick");
             if(onTick.IsValid()) onTick.Call();
         }
@@ -124,6 +164,76 @@ namespace js
             OnTick();
         }
 
+        void ToggleJSEventHandler(alt::CEvent::Type type, bool state)
+        {
+            uint32_t& count = jsEventHandlerCounts[type];
+            if(state) count++;
+            else if(count > 0)
+                count--;
+        }
+        void SetHasGenericEventHandlers(bool state)
+        {
+            hasGenericEventHandlers = state;
+        }
+        bool HasJSEventHandlers(alt::CEvent::Type type) const
+        {
+            if(hasGenericEventHandlers) return true;
+            auto it = jsEventHandlerCounts.find(type);
+            return it != jsEventHandlerCounts.end() && it->second > 0;
+        }
+        // Whether the resource still needs the event to be enabled in the core
+        virtual bool IsEventUsed(alt::CEvent::Type type) const
+        {
+            return HasJSEventHandlers(type) || metaEventHandlers.Has(type) || (metaCache.IsEnabled() && MetaCache::IsInvalidationEvent(type));
+        }
+        // Has to be called after the handlers for the event changed, enables or disables the event in the core
+        // when this resource starts or stops using it and no other resource uses it
+        void UpdateCoreEvent(alt::CEvent::Type type)
+        {
+            bool used = IsEventUsed(type);
+            if(used == usedCoreEvents.contains(type)) return;
+
+            uint32_t& userCount = coreEventUserCounts[type];
+            if(used)
+            {
+                usedCoreEvents.insert(type);
+                if(userCount++ == 0) alt::ICore::Instance().ToggleEvent(type, true);
+            }
+            else
+            {
+                usedCoreEvents.erase(type);
+                if(--userCount == 0) alt::ICore::Instance().ToggleEvent(type, false);
+            }
+        }
+        void UpdateCoreEvents()
+        {
+            std::vector<alt::CEvent::Type> types(usedCoreEvents.begin(), usedCoreEvents.end());
+            for(alt::CEvent::Type type : types) UpdateCoreEvent(type);
+        }
+
+        MetaEventHandlers& GetMetaEventHandlers()
+        {
+            return metaEventHandlers;
+        }
+        MetaCache& GetMetaCache()
+        {
+            return metaCache;
+        }
+        ErrorTracker& GetErrorTracker()
+        {
+            return errorTracker;
+        }
+
+        const std::string* GetScriptName(int scriptId) const
+        {
+            auto it = scriptNames.find(scriptId);
+            return it == scriptNames.end() ? nullptr : &it->second;
+        }
+        const std::string& SetScriptName(int scriptId, const std::string& name)
+        {
+            return scriptNames[scriptId] = name;
+        }
+
         void InitializeBindings(Binding::Scope scope, Module& altModule);
         void SetBindingExport(const std::string& name, v8::Local<v8::Value> val)
         {
@@ -5,6 +5,7 @@
 
 #include "Module.h"
 #include "Class.h"
+#include "helpers/StringTable.h"
 
 namespace js
 {
@@ -23,10 +24,15 @@ namespace js
 
         virtual bool Initialize()
         {
+            StringTable::Initialize(isolate);
             Class::Initialize(isolate);
             Module::Initialize(isolate);
             return true;
         }
+        void OnDispose() override
+        {
+            StringTable::Cleanup();
+        }
 
         alt::IResource::Impl* CreateImpl(alt::IResource* resource) override
         {
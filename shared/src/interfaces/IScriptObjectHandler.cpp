@@ -4,6 +4,8 @@
 
 js::ScriptObject* js::IScriptObjectHandler::GetOrCreateScriptObject(v8::Local<v8::Context> context, alt::IBaseObject* object)
 {
+    RemoveCollectedScriptObjects();
+
     js::ScriptObject* existingObject = GetScriptObject(object);
     if(existingObject) return existingObject;
 
@@ -30,24 +32,173 @@ js::ScriptObject* js::IScriptObjectHandler::GetOrCreateScriptObject(v8::Local<v8
         return nullptr;
     }
 
+    scriptObject->handler = this;
     objectMap.insert({ object->GetType(), scriptObject });
+
+    // Objects created by custom factories are expected to hold state, so they are always kept alive
+    // Other objects stay strong until a sweep has found them untouched by the script
+    if(weakScriptObjects && !HasCustomFactory(object->GetType()))
+    {
+        if(!basePropertyCountMap.contains(class_)) HasCustomProperties(context, scriptObject);
+        weakCandidates.insert(scriptObject);
+    }
     return scriptObject;
 }
 
 void js::IScriptObjectHandler::DestroyScriptObject(alt::IBaseObject* object)
 {
+    RemoveCollectedScriptObjects();
+
     auto range = objectMap.equal_range(object->GetType());
     for(auto it = range.first; it != range.second; ++it)
     {
         if(it->second->GetObject() == object)
         {
+            ScriptObject* scriptObject = it->second;
             objectMap.erase(it);
-            ScriptObject::Destroy(it->second);
+            weakCandidates.erase(scriptObject);
+            ScriptObject::Destroy(scriptObject);
             break;
         }
     }
 }
 
+void js::IScriptObjectHandler::RemoveCollectedScriptObjects()
+{
+    if(collectedObjects.empty()) return;
+
+    std::vector<ScriptObject*> objects = std::move(collectedObjects);
+    collectedObjects.clear();
+    for(ScriptObject* scriptObject : objects)
+    {
+        auto range = objectMap.equal_range(scriptObject->GetObject()->GetType());
+        for(auto it = range.first; it != range.second; ++it)
+        {
+            if(it->second == scriptObject)
+            {
+                objectMap.erase(it);
+                break;
+            }
+        }
+        weakCandidates.erase(scriptObject);
+        ScriptObject::Destroy(scriptObject);
+    }
+}
+
+bool js::IScriptObjectHandler::HasCustomProperties(v8::Local<v8::Context> context, ScriptObject* scriptObject)
+{
+    v8::Local<v8::Array> keys;
+    if(!scriptObject->Get()->GetOwnPropertyNames(context, v8::PropertyFilter::ALL_PROPERTIES).ToLocal(&keys)) return true;
+
+    Class* class_ = scriptObject->GetClass();
+    auto it = basePropertyCountMap.find(class_);
+    if(it == basePropertyCountMap.end())
+    {
+        // The first instance has not been touched by a script yet, so it has only the properties from the class template
+        basePropertyCountMap.insert({ class_, keys->Length() });
+        return false;
+    }
+    return keys->Length() > it->second;
+}
+
+void js::IScriptObjectHandler::SweepScriptObjects(v8::Local<v8::Context> context)
+{
+    RemoveCollectedScriptObjects();
+    if(weakCandidates.empty()) return;
+
+    // Checking the properties can trigger a GC, so iterate over a copy and skip the collected objects
+    // Weak objects are only checked again if the script set a property on them since the last sweep, which made them strong
+    std::vector<ScriptObject*> objects{ weakCandidates.begin(), weakCandidates.end() };
+    for(ScriptObject* scriptObject : objects)
+    {
+        if(scriptObject->IsCollected() || scriptObject->IsWeak()) continue;
+        if(HasCustomProperties(context, scriptObject))
+        {
+            // The script stores state on the object, so it has to be kept alive for as long as the base object exists
+            weakCandidates.erase(scriptObject);
+            continue;
+        }
+        scriptObject->MakeWeak();
+    }
+}
+
+void js::IScriptObjectHandler::ObjectCollection::Add(alt::IBaseObject* object)
+{
+    if(indices.contains(object)) return;
+    indices.insert({ object, objects.size() });
+    objects.push_back(object);
+    dirty = true;
+}
+
+void js::IScriptObjectHandler::ObjectCollection::Remove(alt::IBaseObject* object)
+{
+    auto it = indices.find(object);
+    if(it == indices.end()) return;
+
+    // Swap with the last object, so the removal doesn't need to move the other objects
+    size_t index = it->second;
+    alt::IBaseObject* lastObject = objects.back();
+    objects[index] = lastObject;
+    indices[lastObject] = index;
+    objects.pop_back();
+    indices.erase(object);
+    dirty = true;
+}
+
+v8::Local<v8::Array> js::IScriptObjectHandler::ObjectCollection::GetArray(v8::Local<v8::Context> context, IScriptObjectHandler* handler)
+{
+    v8::Isolate* isolate = context->GetIsolate();
+    if(!dirty && !cache.IsEmpty()) return cache.Get(isolate);
+
+    std::vector<v8::Local<v8::Value>> values;
+    values.reserve(objects.size());
+    for(alt::IBaseObject* object : objects)
+    {
+        ScriptObject* scriptObject = handler->GetOrCreateScriptObject(context, object);
+        if(!scriptObject) continue;
+        values.push_back(scriptObject->Get());
+    }
+
+    v8::Local<v8::Array> arr = v8::Array::New(isolate, values.data(), values.size());
+    arr->SetIntegrityLevel(context, v8::IntegrityLevel::kFrozen);
+    cache.Reset(isolate, arr);
+    // The array references every script object of the collection, holding it strongly would keep weak script objects alive forever
+    // Once no script references the array anymore, it is collected and rebuilt on the next access
+    if(weakScriptObjects) cache.SetWeak();
+    dirty = false;
+    return arr;
+}
+
+void js::IScriptObjectHandler::InitializeCollections()
+{
+    for(alt::IEntity* entity : alt::ICore::Instance().GetEntities())
+    {
+        AddToCollections(entity);
+    }
+}
+
+void js::IScriptObjectHandler::AddToCollections(alt::IBaseObject* object)
+{
+    if(!dynamic_cast<alt::IEntity*>(object)) return;
+    collectionMap[object->GetType()].Add(object);
+    entityCollection.Add(object);
+}
+
+void js::IScriptObjectHandler::RemoveFromCollections(alt::IBaseObject* object)
+{
+    auto it = collectionMap.find(object->GetType());
+    if(it == collectionMap.end()) return;
+    it->second.Remove(object);
+    entityCollection.Remove(object);
+}
+
+v8::Local<v8::Array> js::IScriptObjectHandler::GetCollectionArray(v8::Local<v8::Context> context, std::optional<alt::IBaseObject::Type> type)
+{
+    ObjectCollection* collection = GetCollection(type);
+    if(!collection) return v8::Array::New(context->GetIsolate());
+    return collection->GetArray(context, this);
+}
+
 void js::IScriptObjectHandler::BindClassToType(alt::IBaseObject::Type type, Class* class_)
 {
     GetClassMap().insert({ type, class_ });
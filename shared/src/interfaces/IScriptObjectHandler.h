@@ -1,6 +1,9 @@
 #pragma once
 
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "cpp-sdk/SDK.h"
 
@@ -12,8 +15,47 @@ namespace js
 
     class IScriptObjectHandler
     {
+        friend class ScriptObject;
+
+        // Stores all entities of a type, and a frozen array of their script objects that is only rebuilt when an entity is added or removed
+        // With weak script objects the array is only held weakly, so it doesn't keep the script objects alive
+        struct ObjectCollection
+        {
+            std::vector<alt::IBaseObject*> objects;
+            std::unordered_map<alt::IBaseObject*, size_t> indices;
+            Persistent<v8::Array> cache;
+            bool dirty = true;
+
+            void Add(alt::IBaseObject* object);
+            void Remove(alt::IBaseObject* object);
+            v8::Local<v8::Array> GetArray(v8::Local<v8::Context> context, IScriptObjectHandler* handler);
+        };
+
+        static inline bool weakScriptObjects = false;
+
         std::unordered_multimap<alt::IBaseObject::Type, ScriptObject*> objectMap;
         std::unordered_map<alt::IBaseObject::Type, Persistent<v8::Function>> customFactoryMap;
+        // Script objects that are made weak by the sweep while they have no custom properties
+        std::unordered_set<ScriptObject*> weakCandidates;
+        std::vector<ScriptObject*> collectedObjects;
+        std::unordered_map<Class*, uint32_t> basePropertyCountMap;  // Amount of own properties a new instance of the class has
+        std::unordered_map<alt::IBaseObject::Type, ObjectCollection> collectionMap;
+        ObjectCollection entityCollection;
+
+        ObjectCollection* GetCollection(std::optional<alt::IBaseObject::Type> type)
+        {
+            if(!type.has_value()) return &entityCollection;
+            auto it = collectionMap.find(type.value());
+            if(it == collectionMap.end()) return nullptr;
+            return &it->second;
+        }
+
+        void OnScriptObjectCollected(ScriptObject* scriptObject)
+        {
+            collectedObjects.push_back(scriptObject);
+        }
+        void RemoveCollectedScriptObjects();
+        bool HasCustomProperties(v8::Local<v8::Context> context, ScriptObject* scriptObject);
 
         static std::unordered_map<alt::IBaseObject::Type, Class*>& GetClassMap()
         {
@@ -26,18 +68,36 @@ namespace js
             if(!GetClassMap().contains(type)) return nullptr;
             return GetClassMap().at(type);
         }
+        static bool IsClassBound(Class* class_)
+        {
+            for(auto& [type, boundClass] : GetClassMap())
+            {
+                if(boundClass == class_) return true;
+            }
+            return false;
+        }
 
     protected:
         void Reset()
         {
+            RemoveCollectedScriptObjects();
             for(auto& [type, scriptObject] : objectMap)
             {
                 ScriptObject::Destroy(scriptObject);
             }
             objectMap.clear();
             customFactoryMap.clear();
+            weakCandidates.clear();
+            basePropertyCountMap.clear();
+            for(auto& [type, collection] : collectionMap) collection.cache.Reset();
+            collectionMap.clear();
+            entityCollection.cache.Reset();
+            entityCollection = ObjectCollection{};
         }
 
+        // Adds all entities that were created before the resource was started
+        void InitializeCollections();
+
     public:
         IScriptObjectHandler() = default;
 
@@ -49,7 +109,7 @@ namespace js
             auto range = objectMap.equal_range(object->GetType());
             for(auto it = range.first; it != range.second; ++it)
             {
-                if(it->second->GetObject() == object)
+                if(it->second->GetObject() == object && !it->second->IsCollected())
                 {
                     return it->second;
                 }
@@ -76,6 +136,45 @@ namespace js
             return customFactoryMap.contains(type);
         }
 
+        // Only entities are stored in the collections, other base objects are ignored
+        void AddToCollections(alt::IBaseObject* object);
+        void RemoveFromCollections(alt::IBaseObject* object);
+
+        // Returns a frozen array of the script objects of all entities with the type, or all entities if no type is specified
+        v8::Local<v8::Array> GetCollectionArray(v8::Local<v8::Context> context, std::optional<alt::IBaseObject::Type> type = std::nullopt);
+        size_t GetCollectionSize(std::optional<alt::IBaseObject::Type> type = std::nullopt)
+        {
+            ObjectCollection* collection = GetCollection(type);
+            return collection ? collection->objects.size() : 0;
+        }
+
+        // Script objects are created strong and only made weak here once they are found without custom properties,
+        // a weak object is made strong again as soon as the script sets a property on it (see ScriptObject::SetupWeakInterceptors)
+        void SweepScriptObjects(v8::Local<v8::Context> context);
+
+        size_t GetScriptObjectCount() const
+        {
+            return objectMap.size() - collectedObjects.size();
+        }
+        size_t GetWeakScriptObjectCount() const
+        {
+            size_t count = 0;
+            for(ScriptObject* scriptObject : weakCandidates)
+            {
+                if(scriptObject->IsWeak() && !scriptObject->IsCollected()) count++;
+            }
+            return count;
+        }
+
         static void BindClassToType(alt::IBaseObject::Type type, Class* class_);
+
+        static void SetWeakScriptObjects(bool state)
+        {
+            weakScriptObjects = state;
+        }
+        static bool AreScriptObjectsWeak()
+        {
+            return weakScriptObjects;
+        }
     };
 }  // namespace js
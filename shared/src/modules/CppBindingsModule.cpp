@@ -14,7 +14,57 @@ static void ToggleEvent(js::FunctionContext& ctx)
     bool state;
     if(!ctx.GetArg(1, state)) return;
 
-    alt::ICore::Instance().ToggleEvent(type, state);
+    js::IResource* resource = ctx.GetResource();
+    resource->ToggleJSEventHandler(type, state);
+    resource->UpdateCoreEvent(type);
+}
+
+static void SetHasGenericEventHandlers(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(1)) return;
+
+    bool state;
+    if(!ctx.GetArg(0, state)) return;
+
+    ctx.GetResource()->SetHasGenericEventHandlers(state);
+}
+
+static void SubscribeMetaChange(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(3)) return;
+
+    alt::CEvent::Type type;
+    if(!ctx.GetArg(0, type)) return;
+    if(!ctx.Check(js::MetaEventHandlers::IsMetaEvent(type), "Event type is not a meta change event")) return;
+
+    std::string key;
+    if(!ctx.GetArg(1, key)) return;
+
+    v8::Local<v8::Value> handler;
+    if(!ctx.GetArg(2, handler, js::Type::FUNCTION)) return;
+
+    js::IResource* resource = ctx.GetResource();
+    resource->GetMetaEventHandlers().Add(type, key, handler.As<v8::Function>());
+    resource->UpdateCoreEvent(type);
+}
+
+static void UnsubscribeMetaChange(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(3)) return;
+
+    alt::CEvent::Type type;
+    if(!ctx.GetArg(0, type)) return;
+
+    std::string key;
+    if(!ctx.GetArg(1, key)) return;
+
+    v8::Local<v8::Value> handler;
+    if(!ctx.GetArg(2, handler, js::Type::FUNCTION)) return;
+
+    js::IResource* resource = ctx.GetResource();
+    bool removed = resource->GetMetaEventHandlers().Remove(type, key, handler.As<v8::Function>());
+    if(removed) resource->UpdateCoreEvent(type);
+    ctx.Return(removed);
 }
 
 static void SetEntityFactory(js::FunctionContext& ctx)
@@ -71,6 +121,7 @@ static void CreateEntity(js::FunctionContext& ctx)
     }
 
     js::IResource* resource = ctx.GetResource();
+    resource->AddToCollections(object);  // Make sure the entity is in .all immediately
     js::ScriptObject* scriptObject = resource->GetOrCreateScriptObject(ctx.GetContext(), object);
     if(!scriptObject)
     {
@@ -80,25 +131,36 @@ static void CreateEntity(js::FunctionContext& ctx)
         return;
     }
 
-    js::Function func = resource->GetBindingExport<v8::Function>("entity:addEntityToAll");
-    if(!ctx.Check(func.IsValid(), "INTERNAL ERROR: Failed to get entity:addEntityToAll function")) return;
-    func.Call(scriptObject->Get());
-
     ctx.Return(scriptObject->Get());
 }
 
+// No type (or undefined) means all entities
+static bool GetEntityTypeArg(js::FunctionContext& ctx, std::optional<alt::IBaseObject::Type>& type)
+{
+    if(!ctx.CheckArgCount(0, 1)) return false;
+    if(ctx.GetArgCount() == 0 || ctx.GetArgType(0) == js::Type::UNDEFINED) return true;
+
+    alt::IBaseObject::Type typeArg;
+    if(!ctx.GetArg(0, typeArg)) return false;
+    type = typeArg;
+    return true;
+}
+
+// Script objects are only created when the entities of a type are requested for the first time
 static void GetAllEntities(js::FunctionContext& ctx)
 {
-    js::IResource* resource = ctx.GetResource();
-    std::vector<alt::IEntity*> entities = alt::ICore::Instance().GetEntities();
-    js::Array entitiesArr;
-    for(auto& object : entities)
-    {
-        js::ScriptObject* scriptObject = resource->GetOrCreateScriptObject(ctx.GetContext(), object);
-        if(!scriptObject) continue;
-        entitiesArr.Push(scriptObject->Get());
-    }
-    ctx.Return(entities);
+    std::optional<alt::IBaseObject::Type> type;
+    if(!GetEntityTypeArg(ctx, type)) return;
+
+    ctx.Return(ctx.GetResource()->GetCollectionArray(ctx.GetContext(), type));
+}
+
+static void GetEntityCount(js::FunctionContext& ctx)
+{
+    std::optional<alt::IBaseObject::Type> type;
+    if(!GetEntityTypeArg(ctx, type)) return;
+
+    ctx.Return((uint32_t)ctx.GetResource()->GetCollectionSize(type));
 }
 
 static void GetCurrentSourceLocation(js::FunctionContext& ctx)
@@ -113,6 +175,59 @@ static void GetCurrentSourceLocation(js::FunctionContext& ctx)
     ctx.Return(obj);
 }
 
+static void CaptureSourceLocation(js::FunctionContext& ctx)
+{
+    int framesToSkip = ctx.GetArg<int>(0, 0);
+
+    ctx.Return(js::CaptureSourceLocation(ctx.GetResource(), framesToSkip).ToNumber());
+}
+
+static void ResolveSourceLocation(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(1)) return;
+
+    double token;
+    if(!ctx.GetArg(0, token)) return;
+
+    js::Object obj;
+    js::SourceLocation location = js::ResolveSourceLocation(ctx.GetResource(), js::SourceLocationToken::FromNumber(token));
+    obj.Set("fileName", location.file);
+    obj.Set("lineNumber", location.line);
+
+    ctx.Return(obj);
+}
+
+static void TrackError(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(1, 2)) return;
+
+    v8::Local<v8::Value> error;
+    if(!ctx.GetArg(0, error)) return;
+
+    v8::Isolate* isolate = ctx.GetIsolate();
+    js::IResource* resource = ctx.GetResource();
+    std::string file;
+    int line = 0;
+    if(error->IsNativeError() || ctx.GetArgCount() == 1)
+    {
+        v8::Local<v8::Message> message = v8::Exception::CreateMessage(isolate, error);
+        file = *v8::String::Utf8Value(isolate, message->GetScriptResourceName());
+        line = message->GetLineNumber(ctx.GetContext()).FromMaybe(0);
+    }
+    else
+    {
+        // Thrown values that are not errors have no stack, so the message would point to the catch block,
+        // use the location the handler was registered at instead
+        double token;
+        if(!ctx.GetArg(1, token)) return;
+        js::SourceLocation location = js::ResolveSourceLocation(resource, js::SourceLocationToken::FromNumber(token));
+        file = location.file;
+        line = location.line;
+    }
+
+    ctx.Return(resource->GetErrorTracker().Track(resource, *v8::String::Utf8Value(isolate, error), file, line));
+}
+
 static void RegisterExport(js::FunctionContext& ctx)
 {
     if(!ctx.CheckArgCount(2)) return;
@@ -139,13 +254,20 @@ static void ResourceNameGetter(js::LazyPropertyContext& ctx)
 static js::Module cppBindingsModule("cppBindings", [](js::ModuleTemplate& module)
 {
     module.StaticFunction("toggleEvent", ToggleEvent);
+    module.StaticFunction("setHasGenericEventHandlers", SetHasGenericEventHandlers);
+    module.StaticFunction("subscribeMetaChange", SubscribeMetaChange);
+    module.StaticFunction("unsubscribeMetaChange", UnsubscribeMetaChange);
     module.StaticFunction("setEntityFactory", SetEntityFactory);
     module.StaticFunction("getEntityFactory", GetEntityFactory);
 
     module.StaticFunction("createEntity", CreateEntity);
     module.StaticFunction("getAllEntities", GetAllEntities);
+    module.StaticFunction("getEntityCount", GetEntityCount);
     module.StaticFunction("getCurrentSourceLocation", GetCurrentSourceLocation);
+    module.StaticFunction("captureSourceLocation", CaptureSourceLocation);
+    module.StaticFunction("resolveSourceLocation", ResolveSourceLocation);
 
+    module.StaticFunction("trackError", TrackError);
     module.StaticFunction("registerExport", RegisterExport);
 
     module.StaticLazyProperty("resourceName", ResourceNameGetter);
@@ -1,6 +1,12 @@
 #include "Module.h"
 #include "Namespace.h"
+#include "Class.h"
 #include "interfaces/IResource.h"
+#include "helpers/MetaBatch.h"
+#include "helpers/HashNames.h"
+
+#include <cmath>
+#include <cctype>
 
 enum class LogType
 {
@@ -9,32 +15,266 @@ enum class LogType
     ERR,
 };
 
+// How values of a class are formatted by the native log formatter, cached on the class prototype
+enum class LogFormat : int32_t
+{
+    INSPECT,
+    VECTOR3,
+    RGBA,
+    BASE_OBJECT,
+};
+
+// Length of the color codes AppendLogColored adds around a value, e.g. `~yl~` and `~w~`
+static constexpr size_t logColorCodesLength = 7;
+
+// Same colors as the inspect function uses
+static void AppendLogColored(std::string& out, const char* color, std::string_view str, bool colors)
+{
+    if(!colors)
+    {
+        out += str;
+        return;
+    }
+    out += '~';
+    out += color;
+    out += '~';
+    out += str;
+    out += "~w~";
+}
+
+static void AppendLogNumber(std::string& out, v8::Local<v8::Context> context, v8::Local<v8::Value> value, bool colors)
+{
+    if(value->IsInt32())
+    {
+        AppendLogColored(out, "yl", std::to_string(value.As<v8::Int32>()->Value()), colors);
+        return;
+    }
+    double number = value.As<v8::Number>()->Value();
+    if(number == 0 && std::signbit(number))
+    {
+        AppendLogColored(out, "yl", "-0", colors);
+        return;
+    }
+    // Let V8 convert the number, so the output matches the JS number to string conversion
+    v8::Local<v8::String> str;
+    if(!value->ToString(context).ToLocal(&str)) return;
+    AppendLogColored(out, "yl", js::CppValue(str), colors);
+}
+
+// Formats primitives like the inspect function does, returns false if the value has to be formatted by inspect
+// Top level strings are logged as they are, nested strings are quoted
+static bool AppendLogPrimitive(std::string& out, v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value, bool colors, bool nested)
+{
+    if(value->IsString())
+    {
+        std::string str = js::CppValue(value.As<v8::String>());
+        if(!nested)
+        {
+            out += str;
+            return true;
+        }
+        // Strings that have to be escaped or use different quotes are left to inspect
+        for(char c : str)
+        {
+            if(c == '\'' || c == '\\' || (unsigned char)c < 0x20) return false;
+        }
+        AppendLogColored(out, "gl", "'" + str + "'", colors);
+        return true;
+    }
+    if(value->IsNumber())
+    {
+        AppendLogNumber(out, context, value, colors);
+        return true;
+    }
+    if(value->IsBoolean())
+    {
+        AppendLogColored(out, "yl", value->IsTrue() ? "true" : "false", colors);
+        return true;
+    }
+    if(value->IsUndefined())
+    {
+        AppendLogColored(out, "kl", "undefined", colors);
+        return true;
+    }
+    if(value->IsNull())
+    {
+        AppendLogColored(out, "wl", "null", colors);
+        return true;
+    }
+    return false;
+}
+
+// Same check as inspect uses to decide whether an object is printed on a single line (see isBelowBreakLength in logging.js),
+// objects that are split into multiple lines are left to inspect
+static bool IsBelowLogBreakLength(size_t entries, size_t entriesLength, size_t openingBraceLength, size_t indentation = 0)
+{
+    constexpr size_t breakLength = 80;
+    return entries * 2 + indentation + openingBraceLength + 10 + entriesLength <= breakLength;
+}
+
+static LogFormat GetLogFormat(js::IResource* resource, v8::Local<v8::Context> context, v8::Local<v8::Object> object, v8::Local<v8::Object> prototype)
+{
+    v8::Isolate* isolate = resource->GetIsolate();
+    v8::Local<v8::Private> key = v8::Private::ForApi(isolate, js::JSKey("alt:logFormat"));
+    v8::Local<v8::Value> cached;
+    if(prototype->GetPrivate(context, key).ToLocal(&cached) && cached->IsInt32()) return (LogFormat)cached.As<v8::Int32>()->Value();
+
+    // Subclasses get their own prototype, so they are only formatted natively if they are the exact class
+    auto isPrototypeOf = [&](const std::string& exportName)
+    {
+        v8::Local<v8::Function> cls = resource->GetBindingExport<v8::Function>(exportName);
+        v8::Local<v8::Value> clsPrototype;
+        return !cls.IsEmpty() && cls->Get(context, js::JSKey("prototype")).ToLocal(&clsPrototype) && clsPrototype->StrictEquals(prototype);
+    };
+    LogFormat format = LogFormat::INSPECT;
+    if(isPrototypeOf("classes:vector3")) format = LogFormat::VECTOR3;
+    else if(isPrototypeOf("classes:rgba"))
+        format = LogFormat::RGBA;
+    else
+    {
+        // Not cached for other objects, the prototype might still be the one of a base object class
+        js::ScriptObject* scriptObject = resource->GetScriptObject(object);
+        if(!scriptObject) return format;
+
+        // Base objects created by a custom factory have the prototype of the subclass, which is left to inspect
+        v8::Local<v8::Function> cls;
+        v8::Local<v8::Value> clsPrototype;
+        if(scriptObject->GetClass()->GetTemplate(isolate).Get()->GetFunction(context).ToLocal(&cls) && cls->Get(context, js::JSKey("prototype")).ToLocal(&clsPrototype) &&
+           clsPrototype->StrictEquals(prototype))
+            format = LogFormat::BASE_OBJECT;
+    }
+
+    prototype->SetPrivate(context, key, v8::Int32::New(isolate, (int32_t)format));
+    return format;
+}
+
+// Formats the own enumerable properties as `Name { key: value }`, if all of them are primitives
+static bool AppendLogObject(std::string& out, v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> object, const std::string& name, bool colors)
+{
+    v8::TryCatch tryCatch(isolate);
+    v8::Local<v8::Array> keys;
+    if(!object->GetOwnPropertyNames(context).ToLocal(&keys)) return false;
+
+    std::string str = name;
+    uint32_t length = keys->Length();
+    if(length == 0)
+    {
+        out += str + " {}";
+        return true;
+    }
+    str += " { ";
+    size_t entriesLength = 0;
+    for(uint32_t i = 0; i < length; i++)
+    {
+        v8::Local<v8::Value> key;
+        v8::Local<v8::Value> value;
+        if(!keys->Get(context, i).ToLocal(&key) || !key->IsString()) return false;
+        if(!object->Get(context, key).ToLocal(&value)) return false;
+
+        // Keys that are no identifiers are quoted by inspect
+        std::string keyStr = js::CppValue(key.As<v8::String>());
+        if(keyStr.empty() || std::isdigit((unsigned char)keyStr[0])) return false;
+        for(char c : keyStr)
+        {
+            if(!std::isalnum((unsigned char)c) && c != '_' && c != '$') return false;
+        }
+
+        if(i > 0) str += ", ";
+        str += keyStr + ": ";
+        size_t valueStart = str.size();
+        if(!AppendLogPrimitive(str, isolate, context, value, colors, true)) return false;
+        entriesLength += keyStr.size() + 2 + str.size() - valueStart - (colors ? logColorCodesLength : 0);
+    }
+    if(!IsBelowLogBreakLength(length, entriesLength, name.size() + 2)) return false;
+    out += str + " }";
+    return true;
+}
+
+static bool AppendLogValue(std::string& out, js::IResource* resource, v8::Local<v8::Context> context, v8::Local<v8::Value> value, bool colors)
+{
+    v8::Isolate* isolate = resource->GetIsolate();
+    if(AppendLogPrimitive(out, isolate, context, value, colors, false)) return true;
+    if(!value->IsObject() || value->IsProxy()) return false;
+
+    v8::Local<v8::Object> object = value.As<v8::Object>();
+    v8::Local<v8::Value> prototype = object->GetPrototype();
+    if(!prototype->IsObject()) return false;
+
+    // Objects with a custom inspect function, on the object or its prototype chain, are always formatted by it
+    v8::Local<v8::Symbol> inspectSymbol = v8::Symbol::For(isolate, js::JSKey("nodejs.util.inspect.custom"));
+    if(object->Has(context, inspectSymbol).FromMaybe(true)) return false;
+
+    switch(GetLogFormat(resource, context, object, prototype.As<v8::Object>()))
+    {
+        case LogFormat::VECTOR3:
+        {
+            // Same output as inspect, the only own property of a vector is the values array
+            v8::Local<v8::Value> values;
+            if(!object->Get(context, js::JSKey("values")).ToLocal(&values) || !values->IsArray()) return false;
+            v8::Local<v8::Array> arr = values.As<v8::Array>();
+            if(arr->Length() != 3) return false;
+            std::string str = "Vector3 { values: [ ";
+            size_t numbersLength = 0;
+            for(uint32_t i = 0; i < 3; i++)
+            {
+                v8::Local<v8::Value> axis;
+                if(!arr->Get(context, i).ToLocal(&axis) || !axis->IsNumber()) return false;
+                if(i > 0) str += ", ";
+                size_t numberStart = str.size();
+                AppendLogNumber(str, context, axis, colors);
+                numbersLength += str.size() - numberStart - (colors ? logColorCodesLength : 0);
+            }
+            // The array is indented by the property, `values: [ `, ` ]` and the separators add 16 characters to the property
+            if(!IsBelowLogBreakLength(3, numbersLength, 1, 2) || !IsBelowLogBreakLength(1, numbersLength + 16, 9)) return false;
+            out += str + " ] }";
+            return true;
+        }
+        case LogFormat::RGBA: return AppendLogObject(out, isolate, context, object, "RGBA", colors);
+        case LogFormat::BASE_OBJECT:
+        {
+            if(!resource->IsBaseObject(object)) return false;
+            return AppendLogObject(out, isolate, context, object, js::CppValue(object->GetConstructorName()), colors);
+        }
+        default: return false;
+    }
+}
+
 template<LogType Type>
 static void Log(js::FunctionContext& ctx)
 {
     js::IResource* resource = ctx.GetResource();
-    js::Function inspectFunc(resource->GetBindingExport<v8::Function>("logging:inspectMultiple"));
-
-    std::vector<v8::Local<v8::Value>> args;
-    args.reserve(ctx.GetArgCount() + 1);
+    v8::Local<v8::Context> context = ctx.GetContext();
+    constexpr bool colors = Type == LogType::INFO;
 
-    js::Object options;
-    options.Set("colors", Type == LogType::INFO);
-    args.push_back(options.Get());
+    // Strings, numbers, booleans, Vector3, RGBA and base objects are formatted natively,
+    // only other values are passed to the inspect function
+    std::string msg;
+    v8::Local<v8::Function> inspectFunc;
+    v8::Local<v8::Object> options;
     for(int i = 0; i < ctx.GetArgCount(); i++)
     {
         v8::Local<v8::Value> val;
         if(!ctx.GetArg(i, val)) continue;
-        args.push_back(val);
+        if(i > 0) msg += ' ';
+        if(AppendLogValue(msg, resource, context, val, colors)) continue;
+
+        if(inspectFunc.IsEmpty())
+        {
+            inspectFunc = resource->GetBindingExport<v8::Function>("logging:inspectMultiple");
+            js::Object inspectOptions;
+            inspectOptions.Set("colors", colors);
+            options = inspectOptions.Get();
+        }
+        auto str = js::Function(inspectFunc).Call<std::string>({ options, val });
+        if(!str) return;
+        msg += str.value();
     }
 
-    auto msg = inspectFunc.Call<std::string>(args);
-    if(!msg) return;
-    if constexpr(Type == LogType::INFO) alt::ICore::Instance().LogColored(msg.value(), resource->GetResource());
+    if constexpr(Type == LogType::INFO) js::Logger::Colored(msg);
     else if constexpr(Type == LogType::WARN)
-        alt::ICore::Instance().LogWarning(msg.value(), resource->GetResource());
+        js::Logger::Warn(msg);
     else if constexpr(Type == LogType::ERR)
-        alt::ICore::Instance().LogError(msg.value(), resource->GetResource());
+        js::Logger::Error(msg);
 }
 
 static void SHA256(js::FunctionContext& ctx)
@@ -47,6 +287,52 @@ static void SHA256(js::FunctionContext& ctx)
     ctx.Return(alt::ICore::Instance().StringToSHA256(str));
 }
 
+static void Hash(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(1)) return;
+    if(!ctx.CheckArgType(0, js::Type::STRING)) return;
+
+    ctx.Return(js::HashString(ctx.GetIsolate(), ctx.GetArg<v8::Local<v8::Value>>(0).As<v8::String>()));
+}
+
+static void HashMany(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(1)) return;
+    if(!ctx.CheckArgType(0, js::Type::ARRAY)) return;
+
+    v8::Isolate* isolate = ctx.GetIsolate();
+    v8::Local<v8::Context> context = ctx.GetContext();
+    v8::Local<v8::Array> strings = ctx.GetArg<v8::Local<v8::Value>>(0).As<v8::Array>();
+    uint32_t length = strings->Length();
+
+    v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(isolate, length * sizeof(uint32_t));
+    uint32_t* hashes = static_cast<uint32_t*>(buffer->GetBackingStore()->Data());
+    for(uint32_t i = 0; i < length; i++)
+    {
+        v8::Local<v8::Value> value;
+        if(!strings->Get(context, i).ToLocal(&value)) return;
+        if(!ctx.Check(value->IsString(), "Expected an array of strings")) return;
+        hashes[i] = js::HashString(isolate, value.As<v8::String>());
+    }
+    ctx.Return(v8::Uint32Array::New(buffer, 0, length));
+}
+
+static void HashToName(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(1)) return;
+
+    uint32_t hash;
+    if(!ctx.GetArg(0, hash)) return;
+
+    const char* name = js::GetHashName(hash);
+    if(!name)
+    {
+        ctx.Return(nullptr);
+        return;
+    }
+    ctx.Return(std::string(name));
+}
+
 static void MetaGetter(js::DynamicPropertyGetterContext& ctx)
 {
     ctx.Return(alt::ICore::Instance().GetMetaData(ctx.GetProperty()));
@@ -76,6 +362,68 @@ static void MetaEnumerator(js::DynamicPropertyEnumeratorContext& ctx)
     ctx.Return(alt::ICore::Instance().GetMetaDataKeys());
 }
 
+static void SetMetaBatch(js::FunctionContext& ctx)
+{
+    js::SetMetaBatch(ctx, "globalMeta", nullptr, [](const std::string& key, alt::MValue value) { alt::ICore::Instance().SetMetaData(key, value); });
+}
+
+static void SetMetaCacheEnabled(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(1)) return;
+
+    bool state;
+    if(!ctx.GetArg(0, state)) return;
+
+    js::IResource* resource = ctx.GetResource();
+    resource->GetMetaCache().SetEnabled(state);
+    // The cache is invalidated by the meta change events, so they have to be received while it is enabled
+    for(alt::CEvent::Type type : js::MetaCache::invalidationEvents) resource->UpdateCoreEvent(type);
+}
+
+static void GetMetaCacheStats(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(0, 1)) return;
+
+    bool reset = false;
+    if(ctx.GetArgCount() == 1 && !ctx.GetArg(0, reset)) return;
+
+    js::MetaCache& cache = ctx.GetResource()->GetMetaCache();
+    uint64_t hits = cache.GetHits();
+    uint64_t misses = cache.GetMisses();
+
+    js::Object stats;
+    stats.Set("enabled", cache.IsEnabled());
+    stats.Set("hits", (double)hits);
+    stats.Set("misses", (double)misses);
+    stats.Set("hitRate", hits + misses == 0 ? 0.0 : (double)hits / (double)(hits + misses));
+    stats.Set("size", (uint32_t)cache.GetSize());
+    if(reset) cache.ResetStats();
+    ctx.Return(stats);
+}
+
+static void GetErrorStats(js::FunctionContext& ctx)
+{
+    if(!ctx.CheckArgCount(0, 1)) return;
+
+    bool reset = false;
+    if(ctx.GetArgCount() == 1 && !ctx.GetArg(0, reset)) return;
+
+    js::ErrorTracker& tracker = ctx.GetResource()->GetErrorTracker();
+    js::Array stats(tracker.GetFingerprints().size());
+    for(auto& [key, fingerprint] : tracker.GetFingerprints())
+    {
+        js::Object entry;
+        entry.Set("message", fingerprint.message);
+        entry.Set("file", fingerprint.file);
+        entry.Set("line", fingerprint.line);
+        entry.Set("count", (double)fingerprint.count);
+        entry.Set("suppressed", (double)fingerprint.suppressed);
+        stats.Push(entry.Get());
+    }
+    if(reset) tracker.ResetCounts();
+    ctx.Return(stats);
+}
+
 // clang-format off
 extern js::Class baseObjectClass, worldObjectClass, entityClass, resourceClass;
 extern js::Namespace enumsNamespace, sharedEventsNamespace;
@@ -89,8 +437,15 @@ static js::Module sharedModule("alt-shared", "", { &baseObjectClass, &worldObjec
     module.StaticFunction("logWarning", Log<LogType::WARN>);
     module.StaticFunction("logError", Log<LogType::ERR>);
     module.StaticFunction("sha256", &SHA256);
+    module.StaticFunction("hash", Hash);
+    module.StaticFunction("hashMany", HashMany);
+    module.StaticFunction("hashToName", HashToName);
 
     module.StaticDynamicProperty("meta", MetaGetter, MetaSetter, MetaDeleter, MetaEnumerator);
+    module.StaticFunction("setMetaBatch", SetMetaBatch);
+    module.StaticFunction("setMetaCacheEnabled", SetMetaCacheEnabled);
+    module.StaticFunction("getMetaCacheStats", GetMetaCacheStats);
+    module.StaticFunction("getErrorStats", GetErrorStats);
 
     module.Namespace("Timers");
     module.Namespace("Utils");
@@ -100,7 +455,6 @@ static js::Module sharedModule("alt-shared", "", { &baseObjectClass, &worldObjec
     module.Namespace("AreaBlip");
     module.Namespace("RadiusBlip");
 
-    module.StaticBindingExport("hash", "utils:hash");
     module.StaticBindingExport("Vector3", "classes:vector3");
     module.StaticBindingExport("Vector2", "classes:vector2");
     module.StaticBindingExport("RGBA", "classes:rgba");
@@ -0,0 +1,42 @@
+// Call overhead of the class bindings from hot loops, the baseline for optimizations of the property and method handlers
+import * as alt from "@altv/server";
+import { bench } from "../harness.js";
+
+const callsPerIteration = 1000000;
+let vehicle;
+
+function getVehicle() {
+    if (!vehicle || !vehicle.valid) vehicle = alt.Vehicle.create({ model: "adder", pos: new alt.Vector3(0, 0, 72) });
+    return vehicle;
+}
+
+bench(
+    "bindings: primitive property getter",
+    () => {
+        const veh = getVehicle();
+        let sum = 0;
+        for (let i = 0; i < callsPerIteration; i++) sum += veh.dimension;
+        return sum;
+    },
+    { iterations: 10, warmup: 2 }
+);
+
+bench(
+    "bindings: primitive property setter",
+    () => {
+        const veh = getVehicle();
+        for (let i = 0; i < callsPerIteration; i++) veh.frozen = (i & 1) === 0;
+    },
+    { iterations: 10, warmup: 2 }
+);
+
+bench(
+    "bindings: object property getter",
+    () => {
+        const veh = getVehicle();
+        let sum = 0;
+        for (let i = 0; i < callsPerIteration; i++) sum += veh.pos.x;
+        return sum;
+    },
+    { iterations: 10, warmup: 2 }
+);
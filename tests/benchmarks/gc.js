@@ -0,0 +1,40 @@
+// GC scenarios to compare the performance profiles, run them once per profile and compare the results.json files
+import * as alt from "@altv/server";
+import v8 from "v8";
+import { test, bench, assert } from "../harness.js";
+
+// Event payload like objects that die young, mostly exercises the scavenger (semi space size, parallel scavenging)
+bench(
+    "gc: short-lived allocations",
+    () => {
+        const payloads = [];
+        for (let i = 0; i < 1000; i++) payloads.push({ id: i, name: `player${i}`, pos: { x: i, y: i, z: i }, args: [i, "arg", true] });
+        return payloads.length;
+    },
+    { iterations: 2000, warmup: 100 }
+);
+
+// A large long-lived heap that is slowly replaced, exercises mark-compact (concurrent marking and sweeping, old space size)
+const retained = new Map();
+bench(
+    "gc: retained heap churn",
+    (iteration) => {
+        for (let i = 0; i < 1000; i++) {
+            const key = (iteration * 1000 + i) % 200000;
+            retained.set(key, { key, data: new Array(16).fill(iteration), text: `entry${key}` });
+        }
+    },
+    { iterations: 1000, warmup: 200 }
+);
+
+// The old space limit is the only heap flag that can be read back from JS
+const oldSpaceLimits = { "low-memory": 512 };
+test("gc: heap limit matches the profile", () => {
+    const moduleConfig = alt.serverConfig["js-module-v2"] ?? {};
+    const limit = moduleConfig.gc?.["max-old-space-size"] ?? oldSpaceLimits[moduleConfig.profile];
+    if (!limit) return;
+
+    // The limit also includes the young generation, which is small compared to the old space
+    const heapSizeLimit = v8.getHeapStatistics().heap_size_limit / 1024 / 1024;
+    assert(heapSizeLimit >= limit && heapSizeLimit <= limit + 256, `heap size limit of ${heapSizeLimit.toFixed(0)} MB doesn't match the old space limit of ${limit} MB`);
+});
@@ -0,0 +1,39 @@
+import * as alt from "@altv/server";
+import { test, assert, assertEqual, waitTicks } from "../harness.js";
+
+test("events: local script events reach their handlers", async () => {
+    const received = [];
+    const handler = (ctx) => received.push(ctx.args);
+    alt.Events.on("tests:ping", handler);
+    try {
+        alt.Events.emit("tests:ping", 1, "two");
+        await waitTicks(2);
+    } finally {
+        alt.Events.on.remove("tests:ping", handler);
+    }
+
+    assertEqual(received.length, 1, "handler call count");
+    assertEqual(received[0][0], 1, "first argument");
+    assertEqual(received[0][1], "two", "second argument");
+});
+
+test("events: removed handlers are not called", async () => {
+    let calls = 0;
+    const handler = () => calls++;
+    alt.Events.on("tests:removed", handler);
+    alt.Events.on.remove("tests:removed", handler);
+    alt.Events.emit("tests:removed");
+    await waitTicks(2);
+
+    assertEqual(calls, 0, "handler call count");
+});
+
+test("timers: every tick timers run once per server tick", async () => {
+    let ticks = 0;
+    const timer = alt.Timers.everyTick(() => ticks++);
+    await waitTicks(5);
+    timer.destroy();
+
+    // The timer might be created after the timers of the current tick already ran
+    assert(ticks === 4 || ticks === 5, `every tick timer ran ${ticks} times in 5 ticks`);
+});
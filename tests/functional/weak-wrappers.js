@@ -0,0 +1,58 @@
+// Only run with `weak-wrappers = true` under js-module-v2 in server.toml, otherwise all wrappers are strong anyway
+import * as alt from "@altv/server";
+import { test, assert, assertEqual, waitTicks, collectGarbage } from "../harness.js";
+
+// Untouched wrappers are made weak by a sweep, which runs at least every 10 ticks
+const sweepTicks = 11;
+
+function createVehicle() {
+    return alt.Vehicle.create({ model: "adder", pos: new alt.Vector3(0, 0, 72) });
+}
+
+// Makes untouched wrappers weak, collects them and runs the weak callbacks
+async function sweepAndCollect() {
+    await waitTicks(sweepTicks);
+    await collectGarbage();
+}
+
+if (alt.serverConfig["js-module-v2"]?.["weak-wrappers"]) {
+    test("weak wrappers: a referenced wrapper keeps its identity", async () => {
+        const vehicle = createVehicle();
+        try {
+            await sweepAndCollect();
+            assert(alt.Vehicle.getByID(vehicle.id) === vehicle, "wrapper returned after the sweep is the referenced wrapper");
+        } finally {
+            vehicle.destroy();
+        }
+    });
+
+    test("weak wrappers: own properties survive the sweep", async () => {
+        let vehicle = createVehicle();
+        const id = vehicle.id;
+        vehicle.customState = { owner: "tests" };
+        vehicle = null;
+        try {
+            await sweepAndCollect();
+            await sweepAndCollect();
+            assertEqual(alt.Vehicle.getByID(id)?.customState?.owner, "tests", "own property after the sweep");
+        } finally {
+            alt.Vehicle.getByID(id)?.destroy();
+        }
+    });
+
+    // Documented limitation: a WeakMap entry doesn't keep the wrapper alive, so it is lost with the collected wrapper
+    test("weak wrappers: WeakMap entries of untouched wrappers are lost", async () => {
+        let vehicle = createVehicle();
+        const id = vehicle.id;
+        const state = new WeakMap([[vehicle, "state"]]);
+        const ref = new WeakRef(vehicle);
+        vehicle = null;
+        try {
+            await sweepAndCollect();
+            assertEqual(ref.deref(), undefined, "collected wrapper");
+            assertEqual(state.has(alt.Vehicle.getByID(id)), false, "WeakMap entry of the recreated wrapper");
+        } finally {
+            alt.Vehicle.getByID(id)?.destroy();
+        }
+    });
+} else alt.log("~y~Weak wrapper tests skipped, weak-wrappers is not enabled");
@@ -0,0 +1,159 @@
+// Minimal test and benchmark runner for the tests resource, runs inside a jsv2 resource on an alt:V server
+import * as alt from "@altv/server";
+import fs from "fs";
+import path from "path";
+import v8 from "v8";
+import vm from "vm";
+import { performance, PerformanceObserver } from "perf_hooks";
+
+// Forcing a GC is needed to test weak script objects and to start benchmarks with a clean heap
+v8.setFlagsFromString("--expose-gc");
+const gc = vm.runInNewContext("gc");
+
+/** @type {({ kind: "test" | "bench", name: string, fn: Function, options: { iterations: number, warmup: number } })[]} */
+const entries = [];
+
+/**
+ * Registers a functional test, the test fails if the function throws or the returned promise rejects
+ * @param {string} name
+ * @param {() => void | Promise<void>} fn
+ */
+export function test(name, fn) {
+    entries.push({ kind: "test", name, fn, options: { iterations: 1, warmup: 0 } });
+}
+
+/**
+ * Registers a benchmark, the function is called `iterations` times after `warmup` calls that are not measured
+ * @param {string} name
+ * @param {(iteration: number) => void | Promise<void>} fn
+ * @param {{ iterations?: number, warmup?: number }} [options]
+ */
+export function bench(name, fn, options = {}) {
+    entries.push({ kind: "bench", name, fn, options: { iterations: options.iterations ?? 1, warmup: options.warmup ?? 0 } });
+}
+
+export function assert(condition, message) {
+    if (!condition) throw new Error(`Assertion failed: ${message}`);
+}
+
+export function assertEqual(actual, expected, message) {
+    if (!Object.is(actual, expected)) throw new Error(`Assertion failed: ${message} (expected ${String(expected)}, got ${String(actual)})`);
+}
+
+/**
+ * Resolves after the given amount of server ticks
+ * @param {number} [count]
+ */
+export function waitTicks(count = 1) {
+    return new Promise((resolve) => {
+        let remaining = count;
+        const timer = alt.Timers.everyTick(() => {
+            if (--remaining > 0) return;
+            timer.destroy();
+            resolve();
+        });
+    });
+}
+
+/**
+ * Runs a full GC, pending weak callbacks are run by the module on the next ticks
+ */
+export async function collectGarbage() {
+    gc();
+    await waitTicks(2);
+}
+
+// Collects the pauses of all GCs while the observer is connected
+class GCObserver {
+    /** @type {number[]} */
+    #pauses = [];
+    #observer = new PerformanceObserver((list) => {
+        for (const entry of list.getEntries()) this.#pauses.push(entry.duration);
+    });
+
+    start() {
+        this.#observer.observe({ entryTypes: ["gc"] });
+    }
+
+    // GC entries are delivered asynchronously, so wait a tick before disconnecting
+    async stop() {
+        await waitTicks(1);
+        this.#observer.disconnect();
+        return {
+            count: this.#pauses.length,
+            maxPause: this.#pauses.reduce((max, pause) => Math.max(max, pause), 0),
+            totalPause: this.#pauses.reduce((total, pause) => total + pause, 0)
+        };
+    }
+}
+
+async function runTest(entry) {
+    await entry.fn();
+    return {};
+}
+
+async function runBench(entry) {
+    const { iterations, warmup } = entry.options;
+    for (let i = 0; i < warmup; i++) await entry.fn(i);
+    await collectGarbage();
+
+    // Synchronous benchmarks are not awaited, so the measurement doesn't include a microtask per iteration
+    const observer = new GCObserver();
+    observer.start();
+    const start = performance.now();
+    for (let i = 0; i < iterations; i++) {
+        const result = entry.fn(i);
+        if (result instanceof Promise) await result;
+    }
+    const duration = performance.now() - start;
+    const gcStats = await observer.stop();
+
+    return {
+        iterations,
+        duration,
+        opsPerSecond: duration === 0 ? 0 : (iterations / duration) * 1000,
+        gc: gcStats
+    };
+}
+
+function getProfileName() {
+    const moduleConfig = alt.serverConfig["js-module-v2"];
+    return moduleConfig?.profile ?? "default";
+}
+
+/**
+ * Runs all registered tests and benchmarks whose name contains one of the comma separated filters in ALTV_JS_TESTS,
+ * logs the results and writes them to results.json in the resource directory
+ * If ALTV_JS_TESTS_STOP_SERVER is set, the server is stopped afterwards, e.g. for CI
+ */
+export async function run() {
+    const filters = (process.env.ALTV_JS_TESTS ?? "").split(",").filter((filter) => filter.length > 0);
+    const selected = entries.filter((entry) => filters.length === 0 || filters.some((filter) => entry.name.includes(filter)));
+
+    const results = [];
+    let failed = 0;
+    for (const entry of selected) {
+        try {
+            const result = entry.kind === "test" ? await runTest(entry) : await runBench(entry);
+            results.push({ kind: entry.kind, name: entry.name, passed: true, ...result });
+            if (entry.kind === "test") alt.log(`~g~[PASS]~w~ ${entry.name}`);
+            else
+                alt.log(
+                    `~g~[BENCH]~w~ ${entry.name}: ${result.iterations} iterations in ${result.duration.toFixed(2)}ms (${Math.round(result.opsPerSecond)} ops/s), ` +
+                        `${result.gc.count} GCs, max pause ${result.gc.maxPause.toFixed(2)}ms, total pause ${result.gc.totalPause.toFixed(2)}ms`
+                );
+        } catch (e) {
+            failed++;
+            results.push({ kind: entry.kind, name: entry.name, passed: false, error: e instanceof Error ? e.stack : String(e) });
+            alt.logError(`[FAIL] ${entry.name}`);
+            alt.logError(e);
+        }
+    }
+
+    const report = { profile: getProfileName(), passed: selected.length - failed, failed, results };
+    fs.writeFileSync(path.join(alt.Resource.current.path, "results.json"), JSON.stringify(report, null, 4));
+    alt.log(`~y~Tests finished: ${report.passed} passed, ${failed} failed (profile: ${report.profile})`);
+
+    if (process.env.ALTV_JS_TESTS_STOP_SERVER) alt.stopServer();
+    return report;
+}
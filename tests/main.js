@@ -0,0 +1,9 @@
+// Functional tests and benchmark scenarios of the module, see docs/testing.md
+import { run } from "./harness.js";
+
+import "./functional/events.js";
+import "./functional/weak-wrappers.js";
+import "./benchmarks/bindings.js";
+import "./benchmarks/gc.js";
+
+run();
@@ -0,0 +1,201 @@
+// clang-format off
+// Generates the HashNamesMap.cpp file, which contains a perfect hash table of known vehicle, ped and weapon names
+// Usage: node tools/generate-hash-names.js [basePath]
+
+const fs = require("fs").promises;
+const { constants } = require("fs");
+const pathUtil = require("path");
+const crypto = require("crypto");
+
+// Base path should point to the main directory of the repo
+if (process.argv.length < 3) {
+    showError("Missing 'basePath' argument");
+    showUsage();
+    process.exit(1);
+}
+const basePath = process.argv[2];
+
+// Name lists, one name per line
+const namesPath = "tools/hash-names/";
+
+// Full output file
+const resultTemplate = `// !!! THIS FILE WAS AUTOMATICALLY GENERATED (ON {DATE}), DO NOT EDIT MANUALLY !!!
+#include "helpers/HashNames.h"
+
+namespace
+{
+    struct Entry
+    {
+        uint32_t hash;
+        const char* name;
+    };
+
+    constexpr uint32_t bucketCount = {BUCKET_COUNT};
+    constexpr uint32_t tableSize = {TABLE_SIZE};
+
+    // Displacement per bucket, chosen so every known hash has its own slot in the table
+    constexpr uint32_t displacements[bucketCount] = { {DISPLACEMENTS} };
+    constexpr Entry table[tableSize] = {
+        {ENTRIES}
+    };
+
+    constexpr uint32_t GetSlot(uint32_t hash, uint32_t displacement)
+    {
+        uint32_t x = (hash ^ displacement) * 0x9E3779B1u;
+        x ^= x >> 16;
+        return x % tableSize;
+    }
+}  // namespace
+
+const char* js::GetHashName(uint32_t hash)
+{
+    const Entry& entry = table[GetSlot(hash, displacements[hash % bucketCount])];
+    return entry.hash == hash ? entry.name : nullptr;
+}
+`;
+
+// Result output path
+const outputPath = "shared/src/HashNamesMap.cpp";
+
+const hashesOutputPath = "build/hash-names-hashes.json";
+
+(async () => {
+    const outputPathResolved = resolvePath(outputPath);
+    const hashesOutputPathResolved = resolvePath(hashesOutputPath);
+
+    const names = new Map();
+    let sources = "";
+    const listsPath = resolvePath(namesPath);
+    for (const file of (await fs.readdir(listsPath)).sort()) {
+        if (!file.endsWith(".txt")) continue;
+        const src = await fs.readFile(pathUtil.resolve(listsPath, file), "utf8");
+        sources += src;
+        for (const line of src.split(/\r?\n/)) {
+            const name = line.trim().toLowerCase();
+            if (!name || name.startsWith("#")) continue;
+            const hash = joaat(name);
+            if (names.has(hash) && names.get(hash) !== name) {
+                showError(`Hash collision between '${name}' and '${names.get(hash)}'`);
+                process.exit(1);
+            }
+            names.set(hash, name);
+        }
+    }
+
+    await fs.mkdir(resolvePath("build"), { recursive: true });
+    const sourcesHash = getHash(sources);
+    if ((await doesFileExist(outputPathResolved)) && (await doesFileExist(hashesOutputPathResolved))) {
+        const previousHash = JSON.parse(await fs.readFile(hashesOutputPathResolved, "utf8")).names;
+        if (previousHash === sourcesHash) {
+            showLog("No hash names changed, skipping writing hash names result");
+            return;
+        }
+    }
+
+    const { bucketCount, tableSize, displacements, table } = buildPerfectHash([...names.keys()]);
+    const entries = table.map((hash) => (hash === undefined ? `{ 0, nullptr }` : `{ 0x${hash.toString(16).padStart(8, "0")}, "${names.get(hash)}" }`));
+
+    await fs.writeFile(hashesOutputPathResolved, JSON.stringify({ names: sourcesHash }));
+    const outputStr = resultTemplate
+        .replace("{DATE}", `${getDate()} ${getTime()}`)
+        .replace("{BUCKET_COUNT}", bucketCount)
+        .replace("{TABLE_SIZE}", tableSize)
+        .replace("{DISPLACEMENTS}", displacements.join(", "))
+        .replace("{ENTRIES}", entries.join(",\n        "));
+    await fs.writeFile(outputPathResolved, outputStr);
+    showLog(`Wrote ${names.size} hash names to file: ${outputPath}`);
+})();
+
+// Same as alt::ICore::Hash for lowercase ASCII names
+function joaat(str) {
+    let hash = 0;
+    for (let i = 0; i < str.length; i++) {
+        hash = (hash + str.charCodeAt(i)) >>> 0;
+        hash = (hash + (hash << 10)) >>> 0;
+        hash = (hash ^ (hash >>> 6)) >>> 0;
+    }
+    hash = (hash + (hash << 3)) >>> 0;
+    hash = (hash ^ (hash >>> 11)) >>> 0;
+    hash = (hash + (hash << 15)) >>> 0;
+    return hash;
+}
+
+// Has to match GetSlot in the generated file
+function getSlot(hash, displacement, tableSize) {
+    let x = Math.imul((hash ^ displacement) >>> 0, 0x9e3779b1) >>> 0;
+    x = (x ^ (x >>> 16)) >>> 0;
+    return x % tableSize;
+}
+
+// Hash and displace: the hashes are split into buckets, then the largest buckets are placed first
+// by searching a displacement that moves all of their hashes into free slots
+function buildPerfectHash(hashes) {
+    const tableSize = Math.max(1, Math.ceil(hashes.length * 1.25));
+    const bucketCount = Math.max(1, Math.ceil(hashes.length / 4));
+    const buckets = Array.from({ length: bucketCount }, () => []);
+    for (const hash of hashes) buckets[hash % bucketCount].push(hash);
+
+    const displacements = new Array(bucketCount).fill(0);
+    const table = new Array(tableSize).fill(undefined);
+    const order = buckets.map((_, i) => i).sort((a, b) => buckets[b].length - buckets[a].length);
+    for (const bucketIdx of order) {
+        const bucket = buckets[bucketIdx];
+        if (bucket.length === 0) break;
+        for (let displacement = 0; ; displacement++) {
+            const slots = bucket.map((hash) => getSlot(hash, displacement, tableSize));
+            if (slots.some((slot, i) => table[slot] !== undefined || slots.indexOf(slot) !== i)) continue;
+            slots.forEach((slot, i) => (table[slot] = bucket[i]));
+            displacements[bucketIdx] = displacement;
+            break;
+        }
+    }
+    return { bucketCount, tableSize, displacements, table };
+}
+
+function getHash(str) {
+    const hash = crypto.createHash("sha256");
+    hash.update(str);
+    return hash.digest("hex");
+}
+
+async function doesFileExist(path) {
+    try {
+        await fs.access(path, constants.F_OK);
+        return true;
+    } catch (e) {
+        return false;
+    }
+}
+
+function resolvePath(path) {
+    return pathUtil.resolve(__dirname, basePath, path);
+}
+
+function getDate() {
+    const date = new Date();
+    const day = date.getDate(),
+        month = date.getMonth() + 1,
+        year = date.getFullYear();
+    return `${day < 10 ? `0${day}` : day}/${month < 10 ? `0${month}` : month}/${year}`;
+}
+
+function getTime() {
+    const date = new Date();
+    const hours = date.getHours(),
+        minutes = date.getMinutes(),
+        seconds = date.getSeconds();
+    return `${hours < 10 ? `0${hours}` : hours}:${minutes < 10 ? `0${minutes}` : minutes}:${seconds < 10 ? `0${seconds}` : seconds}`;
+}
+
+function showLog(...args) {
+    console.log(`[${getTime()}]`, ...args);
+}
+
+function showError(...args) {
+    console.error(`[${getTime()}]`, ...args);
+}
+
+function showUsage() {
+    showLog("Usage: generate-hash-names.js <basePath>");
+    showLog("<basePath>: Path to the base of the repository");
+}
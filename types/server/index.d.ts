@@ -11,6 +11,8 @@ declare module "@altv/server" {
     export const globalDimension: number;
 
     export const syncedMeta: Record<string, any>;
+    /** Sets all keys of the object at once and emits one `onMetaBatchChange` event in every resource, the per key change events are still emitted */
+    export function setSyncedMetaBatch(values: Record<string, any>): void;
     export const serverConfig: Record<string, any>;
 
     export function setServerPassword(password: string): void;
@@ -218,10 +220,97 @@ declare module "@altv/server" {
 
         export const onRemote: shared.Events.ScriptEvent<ClientScriptEventContext>;
 
-        export function emitPlayers(players: Player[], eventName: string, ...args: any[]): void;
-        export function emitPlayersUnreliable(players: Player[], eventName: string, ...args: any[]): void;
+        export function emitPlayers(players: Player[] | PlayerGroup, eventName: string, ...args: any[]): void;
+        export function emitPlayers(players: Player[] | PlayerGroup, event: PreparedEvent): void;
+        export function emitPlayersUnreliable(players: Player[] | PlayerGroup, eventName: string, ...args: any[]): void;
+        export function emitPlayersUnreliable(players: Player[] | PlayerGroup, event: PreparedEvent): void;
         export function emitAllPlayers(eventName: string, ...args: any[]): void;
+        export function emitAllPlayers(event: PreparedEvent): void;
         export function emitAllPlayersUnreliable(eventName: string, ...args: any[]): void;
+        export function emitAllPlayersUnreliable(event: PreparedEvent): void;
+
+        /**
+         * Emits the event to all players in the dimension within the range of the position.
+         * The players are selected natively, without creating any player objects.
+         */
+        export function emitInRange(pos: shared.Vector3, range: number, dimension: number, eventName: string, ...args: any[]): void;
+        export function emitInRange(pos: shared.Vector3, range: number, dimension: number, event: PreparedEvent): void;
+        export function emitInRangeUnreliable(pos: shared.Vector3, range: number, dimension: number, eventName: string, ...args: any[]): void;
+        export function emitInRangeUnreliable(pos: shared.Vector3, range: number, dimension: number, event: PreparedEvent): void;
+
+        /**
+         * Converts the event name and arguments once, so the same message can be emitted any number of times
+         * by passing it to the emit functions instead of the event name and arguments.
+         */
+        export function prepare(eventName: string, ...args: any[]): PreparedEvent;
+
+        /**
+         * Limits how many events with the name each player can send to this resource, using a token bucket.
+         * Events over the limit are dropped before their arguments are converted.
+         *
+         * Use '*' as the event name to set a combined limit for all events without their own limit.
+         *
+         * @param perSecond How many events are allowed per second on average
+         * @param burst How many events can be sent at once, defaults to perSecond
+         */
+        export function setClientRateLimit(eventName: string, perSecond: number, burst?: number): void;
+        export function removeClientRateLimit(eventName: string): void;
+        /** Returns the dropped event counts, in total and per limited event name */
+        export function getClientRateLimitStats(): { dropped: number; events: Record<string, number> };
+        /** Returns the number of dropped events of the player */
+        export function getClientRateLimitStats(player: Player): number;
+
+        export interface PreparedEvent {
+            readonly eventName: string;
+            /** Approximate size of the serialized arguments in bytes */
+            readonly size: number;
+        }
+
+        /**
+         * A native set of subscribed players that events can be published to.
+         *
+         * Players are unsubscribed automatically when they disconnect.
+         * A topic can also be passed to the emit functions like a player group.
+         */
+        export class Topic extends PlayerGroup {
+            constructor();
+
+            /** Returns false if the player was already subscribed */
+            subscribe(player: Player): boolean;
+            /** Returns false if the player was not subscribed */
+            unsubscribe(player: Player): boolean;
+
+            emit(eventName: string, ...args: any[]): void;
+            emit(event: PreparedEvent): void;
+            emitUnreliable(eventName: string, ...args: any[]): void;
+            emitUnreliable(event: PreparedEvent): void;
+        }
+    }
+
+    export namespace Utils {
+        export namespace Workers {
+            /**
+             * A pool of worker threads bound to the current resource.
+             *
+             * @remarks The function passed to `run` is sent to the worker as source code,
+             * so it can't access any variables from its outer scope.
+             */
+            export class Pool {
+                constructor(size?: number);
+
+                get size(): number;
+                get pending(): number;
+
+                run<T = unknown, R = unknown>(fn: (data: T) => R | Promise<R>, data?: T, transferList?: ReadonlyArray<ArrayBuffer>): Promise<R>;
+                terminate(): void;
+            }
+
+            /** The size of the default pool, configured with `worker-pool-size` in the server config */
+            export const size: number;
+            export const pending: number;
+
+            export function run<T = unknown, R = unknown>(fn: (data: T) => R | Promise<R>, data?: T, transferList?: ReadonlyArray<ArrayBuffer>): Promise<R>;
+        }
     }
 
     export interface BoneInfo {
@@ -239,6 +328,7 @@ declare module "@altv/server" {
         get movementClipSet(): string;
         get bones(): ReadonlyArray<BoneInfo>;
 
+        /** Returns the same frozen object for repeated calls with the same model */
         static get(model: string | number): PedModelInfo;
     }
 
@@ -263,6 +353,7 @@ declare module "@altv/server" {
         doesExtraExist(extraId: number);
         isExtraDefault(extraId: number);
 
+        /** Returns the same frozen object for repeated calls with the same model */
         static get(model: string | number): VehicleModelInfo;
     }
 
@@ -288,6 +379,19 @@ declare module "@altv/server" {
         attachTo(entity: Entity, entityBone: number | string, ownBone: number | string, pos: shared.Vector3, rot: shared.Vector3, enableCollisions: boolean, noFixedRotation: boolean): void;
         detach(): void;
 
+        /**
+         * Subscribes to an event involving this entity, e.g. `PLAYER_DEATH` of a player or `COLSHAPE_EVENT` of an entity entering or leaving a colshape
+         * Only called for events of this entity, other events are not sent to the handler
+         * Throws for event types that are not about entities, e.g. `RESOURCE_START`
+         */
+        on(eventType: shared.Enums.EventType, handler: (ctx: shared.Events.EventContext) => void): void;
+        off(eventType: shared.Enums.EventType, handler: (ctx: shared.Events.EventContext) => void): boolean;
+
+        /** Sets all keys of the object at once and emits one `onMetaBatchChange` event in every resource, the per key change events are still emitted */
+        setSyncedMetaBatch(values: Record<string, any>): void;
+        /** Sets all keys of the object at once and emits one `onMetaBatchChange` event in every resource, the per key change events are still emitted */
+        setStreamSyncedMetaBatch(values: Record<string, any>): void;
+
         set visible(visible: boolean);
         streamed: boolean;
         frozen: boolean;
@@ -321,6 +425,9 @@ declare module "@altv/server" {
         set visible(visible: boolean);
         // Inheritance End
 
+        /** Sets all keys of the object at once and emits one `onMetaBatchChange` event in every resource, the per key change events are still emitted */
+        setLocalMetaBatch(values: Record<string, any>): void;
+
         get ip(): string;
         get socialId(): number;
         get hwidHash(): number;
@@ -556,6 +663,13 @@ declare module "@altv/server" {
         isEntityIn(entity: Entity): boolean;
         isEntityIdIn(entityID: number): boolean;
         isPointIn(position: shared.Vector3): boolean;
+
+        /** Subscribes to entities entering this colshape */
+        onEnter(handler: (ctx: Events.ColshapeEventContext) => void): void;
+        /** Subscribes to entities leaving this colshape */
+        onLeave(handler: (ctx: Events.ColshapeEventContext) => void): void;
+        offEnter(handler: (ctx: Events.ColshapeEventContext) => void): boolean;
+        offLeave(handler: (ctx: Events.ColshapeEventContext) => void): boolean;
     }
 
     export class ColShape {}
@@ -576,7 +690,10 @@ declare module "@altv/server" {
 
     export class VirtualEntityGroup {}
 
-    export interface VirtualEntity extends WorldObject, shared.VirtualEntity {}
+    export interface VirtualEntity extends WorldObject, shared.VirtualEntity {
+        /** Sets all keys of the object at once and emits one `onMetaBatchChange` event in every resource, the per key change events are still emitted */
+        setStreamSyncedMetaBatch(values: Record<string, any>): void;
+    }
 
     export class VirtualEntity {}
 
@@ -596,5 +713,25 @@ declare module "@altv/server" {
         unmutePlayer(player: Player): void;
     }
 
+    /**
+     * A reusable set of players that can be passed to the emit functions instead of an array,
+     * without converting the players on every emit.
+     *
+     * Players are removed from the group automatically when they disconnect.
+     */
+    export class PlayerGroup {
+        constructor(players?: Player[]);
+
+        get players(): ReadonlyArray<Player>;
+        get size(): number;
+
+        /** Returns false if the player was already in the group */
+        add(player: Player): boolean;
+        /** Returns false if the player was not in the group */
+        remove(player: Player): boolean;
+        has(player: Player): boolean;
+        clear(): void;
+    }
+
     export * from "@altv/shared";
 }
@@ -16,8 +16,48 @@ declare module "@altv/shared" {
 
     export function sha256(data: string): string;
     export function hash(data: string): number;
+    /** Hashes all strings at once, the result has the same order as the input */
+    export function hashMany(data: string[]): Uint32Array;
+    /** Gets the name of a known vehicle, ped or weapon model hash, or null if the hash is unknown */
+    export function hashToName(hash: number): string | null;
 
     export const meta: Record<string, any>;
+    /** Sets all keys of the object at once and emits one `onMetaBatchChange` event in every resource, the per key change events are still emitted */
+    export function setMetaBatch(values: Record<string, any>): void;
+
+    export interface MetaCacheStats {
+        readonly enabled: boolean;
+        readonly hits: number;
+        readonly misses: number;
+        /** Between 0 and 1 */
+        readonly hitRate: number;
+        /** Amount of currently cached values */
+        readonly size: number;
+    }
+    /**
+     * Caches converted synced, stream synced, local and global synced meta values of this resource until they change or the tick ends.
+     * Cached objects and arrays are frozen, as the same value is returned to every reader.
+     * While the cache is enabled the synced, stream synced, local synced and global synced meta change events stay enabled,
+     * so changes made by other resources are noticed as well.
+     */
+    export function setMetaCacheEnabled(state: boolean): void;
+    export function getMetaCacheStats(resetStats?: boolean): MetaCacheStats;
+
+    export interface ErrorStats {
+        readonly message: string;
+        readonly file: string;
+        readonly line: number;
+        /** How often the error was thrown */
+        readonly count: number;
+        /** How often the error was not logged because of the rate limit */
+        readonly suppressed: number;
+    }
+    /**
+     * Gets the errors caught in this resource, grouped by message and location.
+     * Only the first few occurrences of an error per time window are logged, the rest is summarized as "repeated N times".
+     * Errors that were not thrown again for a whole time window are removed from the stats.
+     */
+    export function getErrorStats(resetStats?: boolean): ErrorStats[];
 
     export namespace Timers {
         class Timer {
@@ -269,7 +309,8 @@ declare module "@altv/shared" {
             ENTITY_LEAVE_COLSHAPE,
             ENTITY_ENTER_CHECKPOINT,
             ENTITY_LEAVE_CHECKPOINT,
-            ERROR
+            ERROR,
+            META_BATCH_CHANGE
         }
     }
 
@@ -284,6 +325,12 @@ declare module "@altv/shared" {
             remove(callback: (context: Context) => void): void;
             readonly listeners: ReadonlyArray<(context: Context) => void>;
         }
+        export interface MetaEvent<Context extends EventContext> extends Event<Context> {
+            /** Only called for changes of the given keys, changes of other keys are filtered out before their values are converted */
+            (keys: string | string[], callback: (context: Context) => void): void;
+
+            remove(keys: string | string[], callback: (context: Context) => void): void;
+        }
         export interface ScriptEvent<Context extends ScriptEventContext> {
             (name: string, callback: (context: Context) => void): void;
 
@@ -342,6 +389,12 @@ declare module "@altv/shared" {
             readonly oldValue: any;
             readonly newValue: any;
         }
+        interface MetaBatchChangeEventContext extends EventContext {
+            /** Null for global meta */
+            readonly object: BaseObject | null;
+            readonly metaType: "meta" | "globalMeta" | "syncedMeta" | "streamSyncedMeta" | "localMeta" | "globalSyncedMeta";
+            readonly keys: ReadonlyArray<string>;
+        }
         interface BaseObjectCreateEventContext extends EventContext {
             readonly object: BaseObject;
         }
@@ -364,11 +417,12 @@ declare module "@altv/shared" {
 
         export const onPlayerAnimationChange: Event<PlayerAnimationChangeEventContext>;
 
-        export const onLocalMetaChange: Event<LocalMetaChangeEventContext>;
-        export const onSyncedMetaChange: Event<SyncedMetaChangeEventContext>;
-        export const onStreamSyncedMetaChange: Event<StreamSyncedMetaChangeEventContext>;
-        export const onGlobalMetaChange: Event<GlobalMetaChangeEventContext>;
-        export const onSyncedGlobalMetaChange: Event<SyncedGlobalMetaChangeEventContext>;
+        export const onLocalMetaChange: MetaEvent<LocalMetaChangeEventContext>;
+        export const onSyncedMetaChange: MetaEvent<SyncedMetaChangeEventContext>;
+        export const onStreamSyncedMetaChange: MetaEvent<StreamSyncedMetaChangeEventContext>;
+        export const onGlobalMetaChange: MetaEvent<GlobalMetaChangeEventContext>;
+        export const onSyncedGlobalMetaChange: MetaEvent<SyncedGlobalMetaChangeEventContext>;
+        export const onMetaBatchChange: Event<MetaBatchChangeEventContext>;
 
         export const onBaseObjectCreate: Event<BaseObjectCreateEventContext>;
         export const onBaseObjectRemove: Event<BaseObjectRemoveEventContext>;
@@ -531,6 +585,8 @@ declare module "@altv/shared" {
         get valid(): boolean;
 
         get meta(): Record<string, any>;
+        /** Sets all keys of the object at once and emits one `onMetaBatchChange` event in every resource, the per key change events are still emitted */
+        setMetaBatch(values: Record<string, any>): void;
 
         destroy(): void;
     }
@@ -558,7 +614,10 @@ declare module "@altv/shared" {
     }
 
     export class Entity {
+        /** Frozen and reused until an entity of the type is created or removed, copy it (e.g. `[...Entity.all]`) to sort or modify it */
         static get all(): ReadonlyArray<Entity>;
+        static get count(): number;
+        static [Symbol.iterator](): IterableIterator<Entity>;
     }
 
     export interface Ped extends Entity {
@@ -569,7 +628,10 @@ declare module "@altv/shared" {
     }
 
     export class Ped {
+        /** Frozen and reused until an entity of the type is created or removed, copy it (e.g. `[...Entity.all]`) to sort or modify it */
         static get all(): ReadonlyArray<Ped>;
+        static get count(): number;
+        static [Symbol.iterator](): IterableIterator<Ped>;
     }
 
     export interface Player extends Entity {
@@ -609,7 +671,10 @@ declare module "@altv/shared" {
     }
 
     export class Player {
+        /** Frozen and reused until an entity of the type is created or removed, copy it (e.g. `[...Entity.all]`) to sort or modify it */
         static get all(): ReadonlyArray<Player>;
+        static get count(): number;
+        static [Symbol.iterator](): IterableIterator<Player>;
     }
 
     export interface Vehicle extends Entity {
@@ -689,7 +754,10 @@ declare module "@altv/shared" {
     }
 
     export class Vehicle {
+        /** Frozen and reused until an entity of the type is created or removed, copy it (e.g. `[...Entity.all]`) to sort or modify it */
         static get all(): ReadonlyArray<Player>;
+        static get count(): number;
+        static [Symbol.iterator](): IterableIterator<Vehicle>;
     }
 
     export interface NetworkObject extends Entity {
@@ -699,7 +767,10 @@ declare module "@altv/shared" {
     }
 
     export class NetworkObject {
+        /** Frozen and reused until an entity of the type is created or removed, copy it (e.g. `[...Entity.all]`) to sort or modify it */
         static get all(): ReadonlyArray<NetworkObject>;
+        static get count(): number;
+        static [Symbol.iterator](): IterableIterator<NetworkObject>;
     }
 
     export interface Blip extends BaseObject {
@@ -34,6 +34,11 @@ option("debug-bindings")
     set_default(false)
     set_showmenu(true)
 
+option("debug-allocations")
+    set_description("Count heap allocations per binding (replaces the global allocator)")
+    set_default(false)
+    set_showmenu(true)
+
 option("module-version")
     set_description("Module version")
     set_default("internal")
@@ -48,6 +53,14 @@ rule("generate-bindings")
         end
     end)
 
+rule("generate-hash-names")
+    on_config(function(target)
+        local out = os.iorun("node tools/generate-hash-names.js ..")
+        if out ~= "" and is_mode("debug") then
+            print(out)
+        end
+    end)
+
 rule("update-deps")
     on_config(function(target)
         if not has_config("auto-update-deps") then return end
@@ -77,6 +90,9 @@ target("shared")
     if has_config("debug-bindings") then
         add_defines("DEBUG_BINDINGS=1")
     end
+    if has_config("debug-allocations") then
+        add_defines("DEBUG_ALLOCATIONS=1")
+    end
 
 target("server")
     set_basename("js-module-v2")
@@ -90,7 +106,7 @@ target("server")
         "build"
     )
     add_deps("shared")
-    add_rules("generate-bindings", "update-deps")
+    add_rules("generate-bindings", "generate-hash-names", "update-deps")
     add_defines("ALT_SERVER_API", "NODE_WANT_INTERNALS=1", "HAVE_OPENSSL=1", "HAVE_INSPECTOR=1")
     add_defines("MODULE_VERSION=\"$(module-version)\"")
 
@@ -123,7 +139,7 @@ target("client")
         "build"
     )
     add_deps("shared")
-    add_rules("generate-bindings", "update-deps")
+    add_rules("generate-bindings", "generate-hash-names", "update-deps")
     add_defines("ALT_CLIENT_API", "V8_COMPRESS_POINTERS=1", "V8_31BIT_SMIS_ON_64BIT_ARCH=1", "V8_IMMINENT_DEPRECATION_WARNINGS=1")
     add_defines("MODULE_VERSION=\"$(module-version)\"")
 